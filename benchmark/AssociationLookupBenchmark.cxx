@@ -0,0 +1,133 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/benchmark/AssociationLookupBenchmark.cxx
+ *
+ * @brief Benchmark of looking up, forming and dissolving associations between objects, each of
+ * which goes through the per-object maps from association type to associations, and of the same on
+ * one hub object associated with many others.
+ */
+
+#include "koala/Koala/KoalaApi.h"
+
+#include "BenchmarkObject.h"
+#include "BenchmarkUtility.h"
+
+namespace
+{
+constexpr auto N_OBJECTS = SIZE_T(2000UL);           ///< The number of objects.
+constexpr auto N_ASSOCIATIONS = SIZE_T(4UL);         ///< The associations formed by each object.
+constexpr auto N_REPEATS = SIZE_T(100UL);            ///< The passes over the objects per lookup.
+constexpr auto N_REASSOCIATIONS = SIZE_T(10UL);      ///< The passes dissolving and re-forming them.
+constexpr auto N_HUB_ASSOCIATIONS = SIZE_T(20000UL);  ///< The associations formed by the hub.
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const auto koalaApi = kl::KoalaApi{false};
+    auto &registry = koalaApi.RegisterRegistry<BenchmarkObject>("BenchmarkObject");
+    const auto objects = registry.CreateMany<BenchmarkObject>(N_OBJECTS);
+
+    const auto associate = [&objects](const bool isForming) {
+        for (auto index = SIZE_T(0UL); index < N_OBJECTS; ++index)
+        {
+            for (auto offset = SIZE_T(1UL); offset <= N_ASSOCIATIONS; ++offset)
+            {
+                auto &object = objects[index].get();
+                auto &other = objects[(index + offset) % N_OBJECTS].get();
+
+                if (isForming)
+                    object.Associate(other, std::string{"indicator"});
+
+                else
+                    object.Dissociate(other, std::string{"indicator"});
+            }
+        }
+    };
+
+    associate(true);
+
+    auto nFound = SIZE_T(0UL);
+    const auto isAssociatedSeconds = kl::MeasureSeconds([&]() {
+        for (auto repeat = SIZE_T(0UL); repeat < N_REPEATS; ++repeat)
+        {
+            for (const auto &object : objects)
+            {
+                if (object.get().IsAssociated<BenchmarkObject>(std::string{"indicator"})) ++nFound;
+            }
+        }
+    });
+
+    kl::PrintBenchmarkResult("IsAssociated", N_REPEATS * N_OBJECTS, isAssociatedSeconds);
+
+    auto nAssociated = SIZE_T(0UL);
+    const auto getSeconds = kl::MeasureSeconds([&]() {
+        for (auto repeat = SIZE_T(0UL); repeat < N_REPEATS; ++repeat)
+        {
+            for (const auto &object : objects)
+            {
+                nAssociated += object.get()
+                                   .GetAssociatedObjects<BenchmarkObject>(std::string{"indicator"})
+                                   .size();
+            }
+        }
+    });
+
+    kl::PrintBenchmarkResult("GetAssociatedObjects", N_REPEATS * N_OBJECTS, getSeconds);
+
+    const auto reassociateSeconds = kl::MeasureSeconds([&]() {
+        for (auto repeat = SIZE_T(0UL); repeat < N_REASSOCIATIONS; ++repeat)
+        {
+            associate(false);
+            associate(true);
+        }
+    });
+
+    kl::PrintBenchmarkResult("Dissociate and Associate",
+                             SIZE_T(2UL) * N_REASSOCIATIONS * N_OBJECTS * N_ASSOCIATIONS,
+                             reassociateSeconds);
+
+    auto &hub = registry.Create<BenchmarkObject>();
+    const auto spokes = registry.CreateMany<BenchmarkObject>(N_HUB_ASSOCIATIONS);
+
+    const auto hubAssociateSeconds = kl::MeasureSeconds([&]() {
+        for (const auto &spoke : spokes) hub.Associate(spoke.get(), std::string{"spoke"});
+    });
+
+    kl::PrintBenchmarkResult("Hub Associate", N_HUB_ASSOCIATIONS, hubAssociateSeconds);
+
+    auto nHubFound = SIZE_T(0UL);
+    const auto hubIsAssociatedSeconds = kl::MeasureSeconds([&]() {
+        for (auto repeat = SIZE_T(0UL); repeat < N_REPEATS; ++repeat)
+        {
+            if (hub.IsAssociated<BenchmarkObject>(std::string{"absent"})) ++nHubFound;
+        }
+    });
+
+    kl::PrintBenchmarkResult("Hub IsAssociated with absent indicator", N_REPEATS,
+                             hubIsAssociatedSeconds);
+
+    const auto hubDissociateSeconds = kl::MeasureSeconds([&]() {
+        for (const auto &spoke : spokes) hub.Dissociate(spoke.get(), std::string{"spoke"});
+    });
+
+    kl::PrintBenchmarkResult("Hub Dissociate", N_HUB_ASSOCIATIONS, hubDissociateSeconds);
+
+    KL_ASSERT(((nHubFound == SIZE_T(0UL)) && !hub.IsAssociated<BenchmarkObject>()),
+              "Unexpected hub associations");
+
+    KL_ASSERT(((nFound == N_REPEATS * N_OBJECTS) &&
+               (nAssociated == SIZE_T(2UL) * N_ASSOCIATIONS * N_REPEATS * N_OBJECTS)),
+              "Unexpected associations");
+
+    koalaApi.DeleteRegistry<BenchmarkObject>();
+    return 0;
+}
@@ -0,0 +1,109 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/benchmark/AssociationTableBenchmark.cxx
+ *
+ * @brief Benchmark of the memory taken up by reciprocated associations between objects, held as
+ * rows in the compact association table of the registry, and of the time taken to form them, to
+ * enumerate the objects associated with each and to dissolve them again.
+ */
+
+#include "koala/Koala/KoalaApi.h"
+
+#include "BenchmarkObject.h"
+#include "BenchmarkUtility.h"
+
+#include <iostream>
+
+namespace
+{
+constexpr auto N_OBJECTS = SIZE_T(20000UL);   ///< The number of objects.
+constexpr auto N_ASSOCIATIONS = SIZE_T(4UL);  ///< The associations formed by each object.
+constexpr auto N_REPEATS = SIZE_T(20UL);      ///< The passes over the objects per enumeration.
+
+/**
+ * @brief Print the association bytes of a registry.
+ *
+ * @param name The name of the result.
+ * @param associationBytes The association bytes.
+ */
+void PrintAssociationBytes(const std::string &name, const std::size_t associationBytes)
+{
+    std::cout << name << ": " << associationBytes << " bytes, "
+              << associationBytes / (SIZE_T(2UL) * N_OBJECTS * N_ASSOCIATIONS)
+              << " bytes per association" << std::endl;
+}
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const auto koalaApi = kl::KoalaApi{false};
+    auto &registry = koalaApi.RegisterRegistry<BenchmarkObject>("BenchmarkObject");
+    const auto objects = registry.CreateMany<BenchmarkObject>(N_OBJECTS);
+    const auto emptyBytes = registry.MemoryUsage().m_associationBytes;
+
+    // Each reciprocated association is a row from either end.
+    const auto associateSeconds = kl::MeasureSeconds([&]() {
+        for (auto index = SIZE_T(0UL); index < N_OBJECTS; ++index)
+        {
+            for (auto offset = SIZE_T(1UL); offset <= N_ASSOCIATIONS; ++offset)
+            {
+                objects[index].get().Associate(objects[(index + offset) % N_OBJECTS].get(),
+                                               std::string{"indicator"});
+            }
+        }
+    });
+
+    kl::PrintBenchmarkResult("Associate", N_OBJECTS * N_ASSOCIATIONS, associateSeconds);
+    PrintAssociationBytes("Associations", registry.MemoryUsage().m_associationBytes - emptyBytes);
+
+    auto objectIdSum = SIZE_T(0UL);
+    const auto lookupSeconds = kl::MeasureSeconds([&]() {
+        for (auto repeat = SIZE_T(0UL); repeat < N_REPEATS; ++repeat)
+        {
+            for (const auto &object : objects)
+            {
+                for (const auto &associatedObject :
+                     object.get().GetAssociatedObjects<BenchmarkObject>(std::string{"indicator"}))
+                {
+                    objectIdSum += associatedObject.get().ID();
+                }
+            }
+        }
+    });
+
+    kl::PrintBenchmarkResult("GetAssociatedObjects", N_REPEATS * N_OBJECTS, lookupSeconds);
+
+    // Every object is associated with the N_ASSOCIATIONS objects either side of it.
+    auto expectedIdSum = SIZE_T(0UL);
+    for (const auto &object : objects)
+        expectedIdSum += SIZE_T(2UL) * N_ASSOCIATIONS * object.get().ID();
+
+    const auto dissociateSeconds = kl::MeasureSeconds([&]() {
+        for (auto index = SIZE_T(0UL); index < N_OBJECTS; ++index)
+        {
+            for (auto offset = SIZE_T(1UL); offset <= N_ASSOCIATIONS; ++offset)
+            {
+                objects[index].get().Dissociate(objects[(index + offset) % N_OBJECTS].get(),
+                                                std::string{"indicator"});
+            }
+        }
+    });
+
+    kl::PrintBenchmarkResult("Dissociate", N_OBJECTS * N_ASSOCIATIONS, dissociateSeconds);
+
+    KL_ASSERT(((objectIdSum == N_REPEATS * expectedIdSum) &&
+               !objects.front().get().IsAssociated<BenchmarkObject>()),
+              "Unexpected associations");
+
+    koalaApi.DeleteRegistry<BenchmarkObject>();
+    return 0;
+}
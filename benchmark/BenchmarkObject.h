@@ -0,0 +1,135 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/benchmark/BenchmarkObject.h
+ *
+ * @brief Header file for the benchmark object (BenchmarkObject) class.
+ */
+
+#ifndef KL_BENCHMARK_OBJECT_H
+#define KL_BENCHMARK_OBJECT_H 1
+
+#include "koala/Definitions.h"
+#include "koala/Registry/ObjectAssociation.h"
+#include "koala/Templates/HierarchicalObjectTemplate.h"
+
+/**
+ * @brief BenchmarkObject class.
+ */
+class BenchmarkObject : public kl::HierarchicalObjectTemplate<BenchmarkObject>,
+                        public std::enable_shared_from_this<BenchmarkObject>
+{
+protected:
+    /**
+     * @brief Constructor.
+     *
+     * @param wpRegistry Weak pointer to the associated registry.
+     * @param id Unique ID for the object.
+     * @param wpKoala Weak pointer to the instance of Koala.
+     */
+    BenchmarkObject(Registry_wPtr wpRegistry, const kl::ID_t id, Koala_wPtr wpKoala) noexcept;
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief Get a shared pointer to the object.
+     *
+     * @return A shared pointer to the object.
+     */
+    KL_GET_SHARED_POINTER(BenchmarkObject);
+
+    /**
+     * @brief Get the is-cereal-serializable boolean.
+     *
+     * @return The is-cereal-serializable boolean.
+     */
+    KL_IS_SERIALIZABLE(false);
+
+    /**
+     * @brief Get a string to represent the state of the object in a graph node.
+     *
+     * @return A string to represent the state of the object in a graph node.
+     */
+    std::string GetGraphNodeLabel() const noexcept override;
+
+    friend Registry;  ///< Alias for the object registry from the base class.
+    friend class kl::Koala;
+
+    template <typename T>
+    friend class kl::HierarchicalVisualizationUtility;
+
+    template <typename TA, typename TB>
+    friend class kl::ObjectAssociation;
+
+    template <typename TA, typename TB>
+    friend class kl::RegisteredObjectTemplate;
+
+public:
+    KL_OBJECT_ALIASES(BenchmarkObject);  ///< Aliases for reference wrappers, sets and vectors.
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief Default copy constructor.
+     */
+    BenchmarkObject(const BenchmarkObject &) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    BenchmarkObject(BenchmarkObject &&) = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    BenchmarkObject &operator=(const BenchmarkObject &) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    BenchmarkObject &operator=(BenchmarkObject &&) = default;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~BenchmarkObject() = default;
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief Get a printable name for the object.
+     *
+     * @return A printable name for the object.
+     */
+    KL_PRINTABLE_NAME("BenchmarkObject");
+
+    /**
+     * @brief Get a string that identifies a given instantiation of the object.
+     *
+     * @return A string that identifies a given instantiation of the object.
+     */
+    KL_IDENTIFIER_STRING(this->HasAlias() ? this->Alias() : std::string{});
+};
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+inline BenchmarkObject::BenchmarkObject(Registry_wPtr wpRegistry, const kl::ID_t id,
+                                        Koala_wPtr wpKoala) noexcept
+    : HierarchicalObject(std::move_if_noexcept(wpRegistry), id, std::move_if_noexcept(wpKoala))
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline std::string BenchmarkObject::GetGraphNodeLabel() const noexcept
+{
+    return this->HasAlias() ? this->Alias() : std::to_string(this->ID());
+}
+
+#endif  // #ifndef KL_BENCHMARK_OBJECT_H
@@ -0,0 +1,106 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/benchmark/BenchmarkUtility.h
+ *
+ * @brief Header file for the helpers shared by the koala benchmarks.
+ */
+
+#ifndef KL_BENCHMARK_UTILITY_H
+#define KL_BENCHMARK_UTILITY_H 1
+
+#include "koala/Definitions.h"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace kl
+{
+/**
+ * @brief Time a callable.
+ *
+ * @param function The callable to time.
+ *
+ * @return The elapsed wall-clock time in seconds.
+ */
+template <typename TFUNCTION>
+auto MeasureSeconds(TFUNCTION &&function);
+
+/**
+ * @brief Run a callable on a number of threads at once and time the whole run.
+ *
+ * @param nThreads The number of threads.
+ * @param function The callable, invoked with the index of the thread running it.
+ *
+ * @return The elapsed wall-clock time in seconds, from release of the threads to the last join.
+ */
+template <typename TFUNCTION>
+auto RunConcurrently(const std::size_t nThreads, TFUNCTION &&function);
+
+/**
+ * @brief Print a single benchmark result line.
+ *
+ * @param label The label describing the configuration.
+ * @param nOperations The number of operations performed.
+ * @param seconds The elapsed time in seconds.
+ */
+void PrintBenchmarkResult(const std::string &label, const std::size_t nOperations,
+                          const double seconds);
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+template <typename TFUNCTION>
+inline auto MeasureSeconds(TFUNCTION &&function)
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::forward<TFUNCTION>(function)();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TFUNCTION>
+auto RunConcurrently(const std::size_t nThreads, TFUNCTION &&function)
+{
+    auto isReleased = std::atomic<bool>{false};
+    auto threads = std::vector<std::thread>{};
+    threads.reserve(nThreads);
+
+    for (auto threadIndex = SIZE_T(0UL); threadIndex < nThreads; ++threadIndex)
+    {
+        threads.emplace_back([&isReleased, &function, threadIndex]() {
+            while (!isReleased.load()) std::this_thread::yield();
+            function(threadIndex);
+        });
+    }
+
+    return MeasureSeconds([&]() {
+        isReleased.store(true);
+        for (auto &thread : threads) thread.join();
+    });
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void PrintBenchmarkResult(const std::string &label, const std::size_t nOperations,
+                                 const double seconds)
+{
+    std::cout << std::left << std::setw(48) << label << std::right << std::setw(12) << nOperations
+              << " ops " << std::fixed << std::setprecision(4) << std::setw(10) << seconds << " s "
+              << std::setprecision(0) << std::setw(14)
+              << (seconds > 0. ? static_cast<double>(nOperations) / seconds : 0.) << " ops/s"
+              << std::endl;
+}
+}  // namespace kl
+
+#endif  // #ifndef KL_BENCHMARK_UTILITY_H
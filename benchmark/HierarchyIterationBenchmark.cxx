@@ -0,0 +1,95 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/benchmark/HierarchyIterationBenchmark.cxx
+ *
+ * @brief Benchmark of range-based for-loops over the daughters and daughter edges of an object
+ * with many daughters, whose range-based containers wrap ordered sets of weak pointers, both on one
+ * thread and split into chunks across several.
+ */
+
+#include "koala/Koala/KoalaApi.h"
+
+#include "BenchmarkObject.h"
+#include "BenchmarkUtility.h"
+
+namespace
+{
+constexpr auto N_DAUGHTERS = SIZE_T(100000UL);  ///< The number of daughters.
+constexpr auto N_REPEATS = SIZE_T(8UL);         ///< The passes made over the daughters.
+constexpr auto N_THREADS = SIZE_T(4UL);         ///< The threads sharing a split pass.
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const auto koalaApi = kl::KoalaApi{false};
+    auto &registry = koalaApi.RegisterRegistry<BenchmarkObject>("BenchmarkObject");
+
+    auto &parent = registry.Create<BenchmarkObject>();
+    const auto daughters = registry.CreateMany<BenchmarkObject>(N_DAUGHTERS);
+
+    // Adding each edge from the daughter keeps the search for an equivalent edge short.
+    const auto buildSeconds = kl::MeasureSeconds([&]() {
+        for (const auto &daughter : daughters) daughter.get().AddParentEdge(parent);
+    });
+
+    kl::PrintBenchmarkResult("Build    daughter edges", N_DAUGHTERS, buildSeconds);
+
+    auto idSum = SIZE_T(0UL);
+    const auto daughtersSeconds = kl::MeasureSeconds([&]() {
+        for (auto repeat = SIZE_T(0UL); repeat < N_REPEATS; ++repeat)
+        {
+            for (const auto &daughter : parent.Daughters<BenchmarkObject>()) idSum += daughter.ID();
+        }
+    });
+
+    kl::PrintBenchmarkResult("Iterate  Daughters", N_REPEATS * N_DAUGHTERS, daughtersSeconds);
+
+    auto nEdges = SIZE_T(0UL);
+    const auto edgesSeconds = kl::MeasureSeconds([&]() {
+        for (auto repeat = SIZE_T(0UL); repeat < N_REPEATS; ++repeat)
+        {
+            for (const auto &edge : parent.DaughterEdges())
+            {
+                static_cast<void>(edge);
+                ++nEdges;
+            }
+        }
+    });
+
+    kl::PrintBenchmarkResult("Iterate  DaughterEdges", N_REPEATS * N_DAUGHTERS, edgesSeconds);
+
+    auto splitIdSum = std::atomic<std::size_t>{SIZE_T(0UL)};
+    const auto splitSeconds = kl::MeasureSeconds([&]() {
+        for (auto repeat = SIZE_T(0UL); repeat < N_REPEATS; ++repeat)
+        {
+            const auto daughterRange = parent.Daughters<BenchmarkObject>();
+            const auto chunks = daughterRange.Split(N_THREADS);
+
+            kl::RunConcurrently(chunks.size(), [&](const std::size_t chunkIndex) {
+                auto chunkIdSum = SIZE_T(0UL);
+                for (const auto &daughter : chunks[chunkIndex]) chunkIdSum += daughter.ID();
+                splitIdSum += chunkIdSum;
+            });
+        }
+    });
+
+    kl::PrintBenchmarkResult("Iterate  Daughters split across " + std::to_string(N_THREADS) +
+                                 " threads",
+                             N_REPEATS * N_DAUGHTERS, splitSeconds);
+
+    KL_ASSERT(((idSum > SIZE_T(0UL)) && (nEdges == N_REPEATS * N_DAUGHTERS)),
+              "Unexpected iteration");
+    KL_ASSERT(splitIdSum.load() == idSum, "Unexpected split iteration");
+
+    koalaApi.DeleteRegistry<BenchmarkObject>();
+    return 0;
+}
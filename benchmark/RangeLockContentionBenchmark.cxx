@@ -0,0 +1,105 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/benchmark/RangeLockContentionBenchmark.cxx
+ *
+ * @brief Benchmark of the latency of a writer creating objects and adding daughter edges while a
+ * reader does slow work on each daughter of an object, looping over the range-based container
+ * itself (which holds the edge and registry locks throughout) or over a snapshot of it (which
+ * holds none).
+ */
+
+#include "koala/Koala/KoalaApi.h"
+
+#include "BenchmarkObject.h"
+#include "BenchmarkUtility.h"
+
+#include <algorithm>
+
+namespace
+{
+constexpr auto N_DAUGHTERS = SIZE_T(500UL);  ///< The number of daughters.
+constexpr auto N_PASSES = SIZE_T(4UL);       ///< The passes the reader makes over the daughters.
+constexpr auto WORK_PER_DAUGHTER =
+    std::chrono::microseconds{20};  ///< The reader's slow work on each daughter.
+
+/**
+ * @brief Run the reader and the writer at once and print the writer's latencies.
+ *
+ * @param koalaApi The koala API.
+ * @param isSnapshot Whether the reader loops over a snapshot.
+ */
+void RunContention(const kl::KoalaApi &koalaApi, const bool isSnapshot)
+{
+    auto &registry = koalaApi.RegisterRegistry<BenchmarkObject>("BenchmarkObject");
+    auto &parent = registry.Create<BenchmarkObject>();
+
+    for (const auto &daughter : registry.CreateMany<BenchmarkObject>(N_DAUGHTERS))
+        parent.AddDaughterEdge(daughter.get());
+
+    auto isReaderDone = std::atomic<bool>{false};
+    auto nWrites = SIZE_T(0UL);
+    auto maxLatency = 0.;
+
+    const auto seconds = kl::RunConcurrently(SIZE_T(2UL), [&](const std::size_t threadIndex) {
+        if (threadIndex == SIZE_T(0UL))
+        {
+            for (auto pass = SIZE_T(0UL); pass < N_PASSES; ++pass)
+            {
+                const auto work = [](const BenchmarkObject &) {
+                    std::this_thread::sleep_for(WORK_PER_DAUGHTER);
+                };
+
+                if (isSnapshot)
+                {
+                    for (const auto &daughter : parent.Daughters<BenchmarkObject>().Snapshot())
+                        work(daughter);
+                }
+
+                else
+                {
+                    for (const auto &daughter : parent.Daughters<BenchmarkObject>())
+                        work(daughter);
+                }
+            }
+
+            isReaderDone.store(true);
+            return;
+        }
+
+        while (!isReaderDone.load())
+        {
+            const auto latency = kl::MeasureSeconds(
+                [&]() { parent.AddDaughterEdge(registry.Create<BenchmarkObject>()); });
+
+            maxLatency = std::max(maxLatency, latency);
+            ++nWrites;
+        }
+    });
+
+    kl::PrintBenchmarkResult(std::string{isSnapshot ? "Snapshot" : "Locked  "} +
+                                 " reader: writer max latency " +
+                                 std::to_string(static_cast<long>(maxLatency * 1.e6)) + " us",
+                             nWrites, seconds);
+
+    koalaApi.DeleteRegistry<BenchmarkObject>();
+}
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const auto koalaApi = kl::KoalaApi{false};
+
+    RunContention(koalaApi, false);
+    RunContention(koalaApi, true);
+
+    return 0;
+}
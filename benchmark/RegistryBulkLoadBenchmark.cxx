@@ -0,0 +1,81 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/benchmark/RegistryBulkLoadBenchmark.cxx
+ *
+ * @brief Benchmark of loading objects one at a time, each with an alias, into a registry with and
+ * without a capacity hint, so that the cost of growing the registry indices shows up.
+ */
+
+#include "koala/Koala/KoalaApi.h"
+
+#include "BenchmarkObject.h"
+#include "BenchmarkUtility.h"
+
+namespace
+{
+constexpr auto N_OBJECTS = SIZE_T(1UL) << SIZE_T(20UL);  ///< The number of objects.
+constexpr auto N_SHARDS = SIZE_T(16UL);                  ///< The shard count in sharded mode.
+
+/**
+ * @brief Load the objects into a new registry and print the time taken.
+ *
+ * @param koalaApi The koala API.
+ * @param shardCount The registry shard count.
+ * @param isReserved Whether to reserve space for the objects and their aliases beforehand.
+ * @param maxLoadFactor The maximum load factor of the registry's hash maps.
+ */
+void RunBulkLoad(const kl::KoalaApi &koalaApi, const std::size_t shardCount,
+                 const bool isReserved, const float maxLoadFactor)
+{
+    auto &registry = koalaApi.RegisterRegistry<BenchmarkObject>("BenchmarkObject");
+    registry.ShardCount(shardCount);
+    registry.MaxLoadFactor(maxLoadFactor);
+
+    auto aliases = std::vector<std::string>{};
+    aliases.reserve(N_OBJECTS);
+
+    for (auto index = SIZE_T(0UL); index < N_OBJECTS; ++index)
+        aliases.push_back("benchmark_object_" + std::to_string(index));
+
+    const auto seconds = kl::MeasureSeconds([&]() {
+        if (isReserved) registry.Reserve<BenchmarkObject>(N_OBJECTS, N_OBJECTS);
+
+        for (auto &alias : aliases) registry.CreateByAlias<BenchmarkObject>(std::move(alias));
+    });
+
+    KL_ASSERT(registry.CountAll() == N_OBJECTS, "Unexpected object count");
+
+    kl::PrintBenchmarkResult(std::string{isReserved ? "Reserved   " : "Unreserved "} +
+                                 std::to_string(shardCount) + " shard" +
+                                 (shardCount == SIZE_T(1UL) ? "" : "s") + ", max load factor " +
+                                 std::to_string(maxLoadFactor),
+                             N_OBJECTS, seconds);
+
+    koalaApi.DeleteRegistry<BenchmarkObject>();
+}
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const auto koalaApi = kl::KoalaApi{false};
+
+    for (const auto shardCount : {SIZE_T(1UL), N_SHARDS})
+    {
+        for (const auto maxLoadFactor : {1.0F, 2.0F})
+        {
+            RunBulkLoad(koalaApi, shardCount, false, maxLoadFactor);
+            RunBulkLoad(koalaApi, shardCount, true, maxLoadFactor);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/benchmark/RegistryConcurrencyBenchmark.cxx
+ *
+ * @brief Benchmark of concurrent object creation and retrieval in unsharded and sharded registries.
+ */
+
+#include "koala/Koala/KoalaApi.h"
+
+#include "BenchmarkObject.h"
+#include "BenchmarkUtility.h"
+
+namespace
+{
+constexpr auto N_OBJECTS_PER_THREAD = SIZE_T(20000UL);  ///< The objects created by each thread.
+constexpr auto N_SHARDS = SIZE_T(16UL);                 ///< The shard count in sharded mode.
+constexpr auto MAX_THREADS = SIZE_T(32UL);              ///< The largest thread count to run.
+
+/**
+ * @brief Run the create/get workload for a given thread and shard count.
+ *
+ * @param koalaApi The koala API.
+ * @param nThreads The number of worker threads.
+ * @param shardCount The registry shard count.
+ */
+void RunWorkload(const kl::KoalaApi &koalaApi, const std::size_t nThreads,
+                 const std::size_t shardCount)
+{
+    auto &registry = koalaApi.RegisterRegistry<BenchmarkObject>("BenchmarkObject");
+    registry.ShardCount(shardCount);
+
+    auto objectIds = std::vector<std::vector<kl::ID_t>>(nThreads);
+
+    const auto createSeconds = kl::RunConcurrently(nThreads, [&](const std::size_t threadIndex) {
+        auto &threadObjectIds = objectIds[threadIndex];
+        threadObjectIds.reserve(N_OBJECTS_PER_THREAD);
+
+        for (auto i = SIZE_T(0UL); i < N_OBJECTS_PER_THREAD; ++i)
+            threadObjectIds.push_back(registry.Create<BenchmarkObject>().ID());
+    });
+
+    const auto getSeconds = kl::RunConcurrently(nThreads, [&](const std::size_t threadIndex) {
+        auto idSum = SIZE_T(0UL);
+
+        for (const auto objectId : objectIds[threadIndex])
+            idSum += registry.Get<BenchmarkObject>(objectId).ID();
+
+        KL_ASSERT(idSum > SIZE_T(0UL) || threadIndex == SIZE_T(0UL), "Unexpected ID sum");
+    });
+
+    const auto label = std::to_string(nThreads) + " threads, " + std::to_string(shardCount) +
+                       " shard" + (shardCount == SIZE_T(1UL) ? "" : "s");
+    kl::PrintBenchmarkResult("Create  " + label, nThreads * N_OBJECTS_PER_THREAD, createSeconds);
+    kl::PrintBenchmarkResult("Get     " + label, nThreads * N_OBJECTS_PER_THREAD, getSeconds);
+
+    koalaApi.DeleteRegistry<BenchmarkObject>();
+}
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const auto koalaApi = kl::KoalaApi{false};
+    const auto maxThreads = std::min(
+        MAX_THREADS, std::max(SIZE_T(1UL), SIZE_T(2UL) * std::thread::hardware_concurrency()));
+
+    for (auto nThreads = SIZE_T(1UL); nThreads <= maxThreads; nThreads *= SIZE_T(2UL))
+    {
+        RunWorkload(koalaApi, nThreads, SIZE_T(1UL));
+        RunWorkload(koalaApi, nThreads, N_SHARDS);
+    }
+
+    return 0;
+}
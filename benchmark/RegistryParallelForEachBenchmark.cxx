@@ -0,0 +1,79 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/benchmark/RegistryParallelForEachBenchmark.cxx
+ *
+ * @brief Benchmark of a per-object computation over the whole registry, run serially through
+ * GetAll and in parallel through ParallelForEach with increasing thread counts.
+ */
+
+#include "koala/Koala/KoalaApi.h"
+
+#include "BenchmarkObject.h"
+#include "BenchmarkUtility.h"
+
+namespace
+{
+constexpr auto N_OBJECTS = SIZE_T(1UL) << SIZE_T(20UL);  ///< The number of objects.
+constexpr auto N_ROUNDS = SIZE_T(64UL);  ///< The rounds of arithmetic done per object.
+constexpr auto MAX_THREADS = SIZE_T(32UL);  ///< The largest thread count to run.
+
+/**
+ * @brief Do some arithmetic on an object, standing in for a real per-object computation.
+ *
+ * @param object The object.
+ *
+ * @return The result.
+ */
+auto Compute(const BenchmarkObject &object) noexcept
+{
+    auto value = object.ID();
+
+    for (auto round = SIZE_T(0UL); round < N_ROUNDS; ++round)
+        value = value * SIZE_T(6364136223846793005UL) + SIZE_T(1442695040888963407UL);
+
+    return value;
+}
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const auto koalaApi = kl::KoalaApi{false};
+    auto &registry = koalaApi.RegisterRegistry<BenchmarkObject>("BenchmarkObject");
+    registry.CreateMany<BenchmarkObject>(N_OBJECTS);
+
+    auto serialSum = SIZE_T(0UL);
+    const auto serialSeconds = kl::MeasureSeconds([&]() {
+        for (const auto &object : registry.GetAll<BenchmarkObject>()) serialSum += Compute(object);
+    });
+
+    kl::PrintBenchmarkResult("Serial    GetAll", N_OBJECTS, serialSeconds);
+
+    for (auto nThreads = SIZE_T(1UL); nThreads <= MAX_THREADS; nThreads *= SIZE_T(2UL))
+    {
+        auto parallelSum = std::atomic<std::size_t>{SIZE_T(0UL)};
+        const auto seconds = kl::MeasureSeconds([&]() {
+            koalaApi.ParallelForEach<BenchmarkObject>(
+                [&parallelSum](const BenchmarkObject &object) {
+                    parallelSum.fetch_add(Compute(object), std::memory_order_relaxed);
+                },
+                nThreads);
+        });
+
+        KL_ASSERT(parallelSum.load() == serialSum, "Parallel and serial results differ");
+        kl::PrintBenchmarkResult("Parallel  " + std::to_string(nThreads) + " threads (" +
+                                     std::to_string(serialSeconds / seconds) + "x)",
+                                 N_OBJECTS, seconds);
+    }
+
+    koalaApi.DeleteRegistry<BenchmarkObject>();
+    return 0;
+}
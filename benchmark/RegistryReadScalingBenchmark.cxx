@@ -0,0 +1,88 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/benchmark/RegistryReadScalingBenchmark.cxx
+ *
+ * @brief Benchmark of read throughput against reader thread count, with lookups going through the
+ * registry locks or through read-mostly snapshots.
+ */
+
+#include "koala/Koala/KoalaApi.h"
+
+#include "BenchmarkObject.h"
+#include "BenchmarkUtility.h"
+
+namespace
+{
+constexpr auto N_OBJECTS = SIZE_T(1UL) << SIZE_T(16UL);  ///< The number of objects.
+constexpr auto N_READS_PER_THREAD = SIZE_T(200000UL);    ///< The lookups made by each thread.
+constexpr auto MAX_THREADS = SIZE_T(64UL);               ///< The largest thread count to run.
+
+/**
+ * @brief Run the read workload for a given thread count and mode.
+ *
+ * @param koalaApi The koala API.
+ * @param nThreads The number of reader threads.
+ * @param isReadMostly Whether the registry is in read-mostly mode.
+ */
+void RunWorkload(const kl::KoalaApi &koalaApi, const std::size_t nThreads,
+                 const bool isReadMostly)
+{
+    auto &registry = koalaApi.RegisterRegistry<BenchmarkObject>("BenchmarkObject");
+    registry.ReadMostly(isReadMostly);
+
+    auto objectIds = kl::IdVector{};
+    objectIds.reserve(N_OBJECTS);
+
+    for (const auto &object : registry.CreateMany<BenchmarkObject>(N_OBJECTS))
+        objectIds.push_back(object.get().ID());
+
+    registry.AddAlias(objectIds.front(), std::string{"first"});
+
+    // Publish the snapshot up front, so that the timed lookups measure the steady state.
+    if (isReadMostly) registry.TakeSnapshot();
+
+    // Each thread strides through the IDs from its own offset, mixing in alias queries and counts.
+    const auto seconds = kl::RunConcurrently(nThreads, [&](const std::size_t threadIndex) {
+        auto idSum = SIZE_T(0UL);
+
+        for (auto i = SIZE_T(0UL); i < N_READS_PER_THREAD; ++i)
+        {
+            const auto objectId = objectIds[(threadIndex * SIZE_T(7919UL) + i) % N_OBJECTS];
+            idSum += registry.Get<BenchmarkObject>(objectId).ID();
+
+            if (i % SIZE_T(16UL) == SIZE_T(0UL))
+                idSum += registry.HasAlias(objectId) ? SIZE_T(1UL) : registry.CountAll();
+        }
+
+        KL_ASSERT(idSum > SIZE_T(0UL), "Unexpected ID sum");
+    });
+
+    const auto label = std::to_string(nThreads) + " threads, " +
+                       (isReadMostly ? "read-mostly snapshots" : "locked lookups");
+    kl::PrintBenchmarkResult("Read  " + label, nThreads * N_READS_PER_THREAD, seconds);
+
+    koalaApi.DeleteRegistry<BenchmarkObject>();
+}
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const auto koalaApi = kl::KoalaApi{false};
+
+    for (auto nThreads = SIZE_T(1UL); nThreads <= MAX_THREADS; nThreads *= SIZE_T(2UL))
+    {
+        RunWorkload(koalaApi, nThreads, false);
+        RunWorkload(koalaApi, nThreads, true);
+    }
+
+    return 0;
+}
@@ -0,0 +1,141 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/benchmark/RegistryStorageBenchmark.cxx
+ *
+ * @brief Benchmark of ID lookup and iteration in the paged slot vector backing the registry,
+ * compared with the unordered map it replaced.
+ */
+
+#include "koala/Koala/KoalaApi.h"
+
+#include "BenchmarkObject.h"
+#include "BenchmarkUtility.h"
+
+#include <random>
+
+namespace
+{
+constexpr auto N_OBJECTS = SIZE_T(1UL) << SIZE_T(20UL);  ///< The number of objects.
+constexpr auto N_REPEATS = SIZE_T(8UL);                  ///< The passes made over the objects.
+
+using BenchmarkObject_sPtr =
+    std::shared_ptr<BenchmarkObject>;  ///< Alias for a shared pointer to a benchmark object.
+using ObjectIdMap =
+    std::unordered_map<kl::ID_t, BenchmarkObject_sPtr>;  ///< Alias for the former ID map.
+
+/**
+ * @brief Slot struct, mirroring the occupancy rule of the registry slots.
+ */
+struct Slot
+{
+    BenchmarkObject_sPtr m_spObject;  ///< Shared pointer to the object.
+
+    /**
+     * @brief Find out whether the slot holds an object.
+     *
+     * @return Whether the slot holds an object.
+     */
+    explicit operator bool() const noexcept { return static_cast<bool>(m_spObject); }
+};
+
+/**
+ * @brief Time random-order lookups of every object, and print the result.
+ *
+ * @param label The label describing the storage.
+ * @param objectIds The object IDs, in lookup order.
+ * @param findObject Callable taking an object ID and returning a pointer to the object.
+ */
+template <typename TFINDOBJECT>
+void RunLookups(const std::string &label, const kl::IdVector &objectIds, TFINDOBJECT &&findObject)
+{
+    auto idSum = SIZE_T(0UL);
+
+    const auto seconds = kl::MeasureSeconds([&]() {
+        for (auto repeat = SIZE_T(0UL); repeat < N_REPEATS; ++repeat)
+        {
+            for (const auto objectId : objectIds) idSum += findObject(objectId)->ID();
+        }
+    });
+
+    KL_ASSERT(idSum > SIZE_T(0UL), "Unexpected ID sum");
+    kl::PrintBenchmarkResult("Lookup    " + label, N_REPEATS * objectIds.size(), seconds);
+}
+
+/**
+ * @brief Time iteration over every object, and print the result.
+ *
+ * @param label The label describing the storage.
+ * @param forEachObject Callable taking a function and calling it on every object.
+ */
+template <typename TFOREACHOBJECT>
+void RunIteration(const std::string &label, TFOREACHOBJECT &&forEachObject)
+{
+    auto idSum = SIZE_T(0UL);
+
+    const auto seconds = kl::MeasureSeconds([&]() {
+        for (auto repeat = SIZE_T(0UL); repeat < N_REPEATS; ++repeat)
+            forEachObject([&idSum](const BenchmarkObject &object) { idSum += object.ID(); });
+    });
+
+    KL_ASSERT(idSum > SIZE_T(0UL), "Unexpected ID sum");
+    kl::PrintBenchmarkResult("Iterate   " + label, N_REPEATS * N_OBJECTS, seconds);
+}
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+int main()
+{
+    const auto koalaApi = kl::KoalaApi{false};
+    auto &registry = koalaApi.RegisterRegistry<BenchmarkObject>("BenchmarkObject");
+
+    auto objectIds = kl::IdVector{};
+    objectIds.reserve(N_OBJECTS);
+
+    // Build the standalone storages from the same objects, so only the containers differ.
+    auto objectIdMap = ObjectIdMap{};
+    auto slots = kl::PagedSlotVector<Slot>{};
+
+    for (const auto &object : registry.CreateMany<BenchmarkObject>(N_OBJECTS))
+    {
+        const auto spObject = object.get().shared_from_this();
+        objectIds.push_back(spObject->ID());
+        objectIdMap.emplace(spObject->ID(), spObject);
+        slots.Emplace(spObject->ID(), Slot{spObject});
+    }
+
+    std::shuffle(objectIds.begin(), objectIds.end(), std::mt19937_64{SIZE_T(42UL)});
+
+    RunLookups("unordered map", objectIds,
+               [&](const kl::ID_t objectId) { return objectIdMap.find(objectId)->second.get(); });
+    RunLookups("paged slot vector", objectIds,
+               [&](const kl::ID_t objectId) { return slots.Find(objectId)->m_spObject.get(); });
+    RunLookups("registry Get", objectIds, [&](const kl::ID_t objectId) {
+        return &registry.Get<BenchmarkObject>(objectId);
+    });
+
+    RunIteration("unordered map", [&](auto &&function) {
+        for (const auto &mapElement : objectIdMap) function(*mapElement.second);
+    });
+    RunIteration("paged slot vector", [&](auto &&function) {
+        slots.ForEach([&](const std::size_t, const Slot &slot) { function(*slot.m_spObject); });
+    });
+    RunIteration("registry GetAll", [&](auto &&function) {
+        for (const auto &object : registry.GetAll<BenchmarkObject>()) function(object);
+    });
+
+    std::cout << "Storage per object: unordered map ~"
+              << (sizeof(ObjectIdMap::value_type) + sizeof(void *) * SIZE_T(2UL)) +
+                     sizeof(void *) * objectIdMap.bucket_count() / objectIdMap.size()
+              << " bytes, paged slot vector ~" << sizeof(Slot) << " bytes" << std::endl;
+
+    koalaApi.DeleteRegistry<BenchmarkObject>();
+    return 0;
+}
@@ -226,6 +226,18 @@ public:
                                       std::string &&>::value) ->
         typename std::decay_t<TOBJECT>::Registry &;
 
+    /**
+     * @brief Register a registry for a given type, pre-sized for a number of objects of that type.
+     *
+     * @param printableObjectName A print-worthy name for the object type.
+     * @param capacityHint The number of objects expected.
+     *
+     * @return The registry.
+     */
+    template <typename TOBJECT>
+    auto RegisterRegistry(std::string printableObjectName, const std::size_t capacityHint) ->
+        typename std::decay_t<TOBJECT>::Registry &;
+
     /**
      * @brief Run an algorithm. The template parameter TALGORITHM can just be the Algorithm type.
      *
@@ -317,6 +329,14 @@ public:
     template <typename TOBJECT>
     void DeleteRegistry();
 
+    /**
+     * @brief Estimate the memory held by every registry and its objects, plus Koala's own registry
+     * sets and maps.
+     *
+     * @return The memory report.
+     */
+    auto MemoryUsage() const;
+
 protected:
     /**
      * @brief Constructor.
@@ -689,6 +709,28 @@ inline void Koala::DisableLogging()
 
 //--------------------------------------------------------------------------------------------------
 
+inline auto Koala::MemoryUsage() const
+{
+    const auto lock = ReadLock{m_mutexRegistries};
+
+    auto memoryReport = MemoryReport{};
+    memoryReport.m_mutexBytes = SIZE_T(4UL) * sizeof(Mutex);
+    memoryReport.m_indexBytes = HashContainerBytes(m_serializableRegistries) +
+                                HashContainerBytes(m_unserializableRegistries) +
+                                HashContainerBytes(m_serializableAssocTypeMap) +
+                                HashContainerBytes(m_unserializableAssocTypeMap);
+
+    for (const auto &spRegistry : m_serializableRegistries)
+        memoryReport += spRegistry->MemoryUsage();
+
+    for (const auto &spRegistry : m_unserializableRegistries)
+        memoryReport += spRegistry->MemoryUsage();
+
+    return memoryReport;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 template <typename TOBJECT>
 void Koala::AdoptRegistry(Koala &koala)
 {
@@ -164,6 +164,20 @@ auto Koala::RegisterRegistry(std::string printableObjectName) noexcept(
 
 //--------------------------------------------------------------------------------------------------
 
+template <typename TOBJECT>
+auto Koala::RegisterRegistry(std::string printableObjectName, const std::size_t capacityHint) ->
+    typename std::decay_t<TOBJECT>::Registry &
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    auto &registry = this->RegisterRegistry<TOBJECT_D>(std::move(printableObjectName));
+    registry.template Reserve<TOBJECT_D>(capacityHint);
+
+    return registry;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 template <typename TALGORITHM, typename... TARGS>
 void Koala::RunAlgorithm(const std::string &algorithmName, TARGS &&... arguments)
 {
@@ -133,6 +133,19 @@ public:
     auto RegisterRegistry(std::string printableObjectName) const & ->
         typename std::decay_t<TOBJECT>::Registry &;
 
+    /**
+     * @brief Register a registry for a given type, pre-sized for a number of objects of that type.
+     *
+     * @param printableObjectName A print-worthy name for the object type.
+     * @param capacityHint The number of objects expected.
+     *
+     * @return The registry.
+     */
+    template <typename TOBJECT>
+    auto RegisterRegistry(std::string printableObjectName,
+                          const std::size_t capacityHint) const & ->
+        typename std::decay_t<TOBJECT>::Registry &;
+
     /**
      * @brief Get an object registry.
      *
@@ -162,6 +175,29 @@ public:
     template <typename TOBJECT, typename TALIAS, typename... TARGS>
     auto &CreateByAlias(TALIAS &&alias, TARGS &&... arguments) const;
 
+    /**
+     * @brief Create a number of objects of a given type.
+     *
+     * @param count The number of objects to create.
+     * @param arguments The arguments to be passed to each object's constructor.
+     *
+     * @return References to the created objects.
+     */
+    template <typename TOBJECT, typename... TARGS>
+    auto CreateMany(const std::size_t count, const TARGS &... arguments) const;
+
+    /**
+     * @brief Create a number of objects of a given type, with constructor arguments given by a
+     * generator.
+     *
+     * @param count The number of objects to create.
+     * @param generator The generator, taking the object index and returning a tuple of arguments.
+     *
+     * @return References to the created objects.
+     */
+    template <typename TOBJECT, typename TGENERATOR>
+    auto CreateManyFrom(const std::size_t count, TGENERATOR &&generator) const;
+
     /**
      * @brief Get an object by alias, ID or a copy of the object.
      *
@@ -188,6 +224,28 @@ public:
     template <typename TOBJECT>
     auto GetAll() const noexcept;
 
+    /**
+     * @brief Get the objects of a given type whose IDs lie in a given range, in ID order.
+     *
+     * @param firstId The first ID in the range.
+     * @param lastId The last ID in the range (by default, the largest ID).
+     *
+     * @return The objects.
+     */
+    template <typename TOBJECT>
+    auto GetRange(const ID_t firstId, const ID_t lastId = std::numeric_limits<ID_t>::max()) const;
+
+    /**
+     * @brief Call a function on every object of a given type across a number of threads.
+     *
+     * @param function The function, taking a reference to the object (called concurrently).
+     * @param nThreads The number of threads, including the calling thread (zero for one per core).
+     *
+     * @return The number of objects visited.
+     */
+    template <typename TOBJECT, typename TFUNCTION>
+    auto ParallelForEach(TFUNCTION &&function, const std::size_t nThreads = SIZE_T(0UL)) const;
+
     /**
      * @brief Get the number of objects of a given type.
      *
@@ -206,6 +264,26 @@ public:
     template <typename TOBJECT, typename T>
     auto Delete(T &&arg) const noexcept;
 
+    /**
+     * @brief Delete all the objects of a given type satisfying a predicate.
+     *
+     * @param predicate The predicate, taking a const reference to the object.
+     *
+     * @return The number of objects deleted.
+     */
+    template <typename TOBJECT, typename TPREDICATE>
+    auto DeleteIf(TPREDICATE &&predicate) const;
+
+    /**
+     * @brief Delete the objects of a given type with the given IDs.
+     *
+     * @param objectIds The IDs of the objects to delete.
+     *
+     * @return The number of objects deleted.
+     */
+    template <typename TOBJECT, typename TIDS>
+    auto DeleteMany(const TIDS &objectIds) const;
+
     /**
      * @brief Delete all the objects of a given type.
      */
@@ -322,6 +400,13 @@ public:
     template <typename TOBJECT>
     void DeleteRegistry() const;
 
+    /**
+     * @brief Estimate the memory held by every registry and its objects, by category.
+     *
+     * @return The memory report.
+     */
+    auto MemoryUsage() const;
+
 #ifdef KOALA_ENABLE_CEREAL
     friend class cereal::access;
 #endif  // #ifdef KOALA_ENABLE_CEREAL
@@ -461,6 +546,13 @@ inline void KoalaApi::DeleteRegistry() const
 
 //--------------------------------------------------------------------------------------------------
 
+inline auto KoalaApi::MemoryUsage() const
+{
+    return m_spKoala->MemoryUsage();
+}
+
+//--------------------------------------------------------------------------------------------------
+
 #ifdef KOALA_ENABLE_CEREAL
 inline KoalaApi::KoalaApi() noexcept : m_spKoala{} {}
 #endif  // #ifdef KOALA_ENABLE_CEREAL
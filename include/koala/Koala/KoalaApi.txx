@@ -27,6 +27,17 @@ inline auto KoalaApi::RegisterRegistry(std::string printableObjectName) const &
 
 //--------------------------------------------------------------------------------------------------
 
+template <typename TOBJECT>
+inline auto KoalaApi::RegisterRegistry(std::string printableObjectName,
+                                       const std::size_t capacityHint) const & ->
+    typename std::decay_t<TOBJECT>::Registry &
+{
+    return m_spKoala->RegisterRegistry<std::decay_t<TOBJECT>>(std::move(printableObjectName),
+                                                              capacityHint);
+}
+
+//--------------------------------------------------------------------------------------------------
+
 template <typename TOBJECT>
 inline auto &KoalaApi::FetchRegistry() const
 {
@@ -55,6 +66,26 @@ inline auto &KoalaApi::CreateByAlias(TALIAS &&alias, TARGS &&... arguments) cons
 
 //--------------------------------------------------------------------------------------------------
 
+template <typename TOBJECT, typename... TARGS>
+inline auto KoalaApi::CreateMany(const std::size_t count, const TARGS &... arguments) const
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+    return m_spKoala->FetchRegistry<TOBJECT_D>().template CreateMany<TOBJECT_D>(count,
+                                                                                 arguments...);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT, typename TGENERATOR>
+inline auto KoalaApi::CreateManyFrom(const std::size_t count, TGENERATOR &&generator) const
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+    return m_spKoala->FetchRegistry<TOBJECT_D>().template CreateManyFrom<TOBJECT_D>(
+        count, std::forward<TGENERATOR>(generator));
+}
+
+//--------------------------------------------------------------------------------------------------
+
 template <typename TOBJECT, typename T>
 inline auto &KoalaApi::Get(T &&arg) const
 {
@@ -82,6 +113,25 @@ inline auto KoalaApi::GetAll() const noexcept
 
 //--------------------------------------------------------------------------------------------------
 
+template <typename TOBJECT>
+inline auto KoalaApi::GetRange(const ID_t firstId, const ID_t lastId) const
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+    return m_spKoala->FetchRegistry<TOBJECT_D>().template GetRange<TOBJECT_D>(firstId, lastId);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT, typename TFUNCTION>
+inline auto KoalaApi::ParallelForEach(TFUNCTION &&function, const std::size_t nThreads) const
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+    return m_spKoala->FetchRegistry<TOBJECT_D>().template ParallelForEach<TOBJECT_D>(
+        std::forward<TFUNCTION>(function), nThreads);
+}
+
+//--------------------------------------------------------------------------------------------------
+
 template <typename TOBJECT>
 inline auto KoalaApi::Count() const noexcept
 {
@@ -99,6 +149,23 @@ inline auto KoalaApi::Delete(T &&arg) const noexcept
 
 //--------------------------------------------------------------------------------------------------
 
+template <typename TOBJECT, typename TPREDICATE>
+inline auto KoalaApi::DeleteIf(TPREDICATE &&predicate) const
+{
+    return m_spKoala->FetchRegistry<std::decay_t<TOBJECT>>().DeleteIf(
+        std::forward<TPREDICATE>(predicate));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT, typename TIDS>
+inline auto KoalaApi::DeleteMany(const TIDS &objectIds) const
+{
+    return m_spKoala->FetchRegistry<std::decay_t<TOBJECT>>().DeleteMany(objectIds);
+}
+
+//--------------------------------------------------------------------------------------------------
+
 template <typename TOBJECT>
 inline void KoalaApi::DeleteAll() const noexcept
 {
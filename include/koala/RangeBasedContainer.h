@@ -15,6 +15,13 @@
 #ifndef KL_RANGE_BASED_CONTAINER_H
 #define KL_RANGE_BASED_CONTAINER_H
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
 namespace kl
 {
 /**
@@ -38,56 +45,104 @@ class ObjectRegistry;
 /**
  * @brief Forward declaration of range-based container class template.
  */
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
 class RangeBasedContainer;
 
+/**
+ * @brief Make a range-based container, deducing the types of its functions so that they can be
+ * inlined into the loops over it.
+ *
+ * @param objectValidityFunction A function to check instance's validity.
+ * @param sharedPtrRetriever A function to retrieve a shared pointer.
+ * @param finalGetterFunction A function to get the final object from cast shared ptr.
+ * @param readLock1 The first mutex read lock.
+ * @param readLock2 The second mutex read lock.
+ * @param objectSets The object sets, or a vector of pointers to them.
+ *
+ * @return The range-based container.
+ */
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER, typename... TSETS>
+auto MakeRangeBasedContainer(TVALIDITY &&objectValidityFunction, TRETRIEVER &&sharedPtrRetriever,
+                             TGETTER &&finalGetterFunction, ReadLock readLock1,
+                             ReadLock readLock2, TSETS &&... objectSets);
+
+/**
+ * @brief Forward declaration of range-based chunk class template.
+ */
+template <typename TRANGEBASEDCONTAINER>
+class RangeBasedChunk;
+
 //--------------------------------------------------------------------------------------------------
 
 /**
  * @brief A custom iterator class template for providing range-based for-loops. Particularly useful
- * for abstract base classes.
+ * for abstract base classes. It walks the object sets viewed by its container, up to a limit,
+ * skipping the objects that fail the container's filters as it goes, so a whole loop is linear in
+ * the number of objects whatever the kind of container. It holds no functions of its own, only a
+ * pointer to the container, so it is cheap to copy. It is a forward iterator, so ranges and chunks
+ * can be handed to the standard algorithms.
  */
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
+template <typename TRANGEBASEDCONTAINER>
 class RangeBasedIterator
 {
 private:
-    using TCONTAINER_D = std::decay_t<TCONTAINER>;        ///< Alias for decayed TCONTAINER type.
-    using TINSTANCE = typename TCONTAINER_D::value_type;  ///< Alias for TINSTANCE type.
-    using TBASE_D = std::decay_t<TBASE>;                  ///< Alias for decayed TBASE type.
-    using TCAST_D = std::decay_t<TCAST>;                  ///< Alias for decayed TCAST type.
-    using TOBJECT_D = std::decay_t<TOBJECT>;              ///< Alias for decayed TOBJECT type.
-
     using RangeBasedContainerInstance =
-        RangeBasedContainer<TCONTAINER_D, TBASE_D, TCAST_D,
-                            TOBJECT_D>;  ///< Alias for specialized range-based container.
-
-    using SharedPtrRetriver = std::function<std::shared_ptr<TBASE_D>(
-        const TINSTANCE &)>;  ///< Alias for shared pointer retriever.
-    using FinalGetterFunction = std::function<TOBJECT_D &(
-        const std::shared_ptr<TCAST_D> &)>;  ///< Alias for final getter function.
+        TRANGEBASEDCONTAINER;  ///< Alias for specialized range-based container.
+    using TCONTAINER_D =
+        typename RangeBasedContainerInstance::TCONTAINER_D;  ///< Alias for the object set type.
+    using TCAST_D = typename RangeBasedContainerInstance::TCAST_D;  ///< Alias for the cast type.
+
+    using ContainerIterator =
+        typename TCONTAINER_D::const_iterator;  ///< Alias for the underlying container iterator.
+    using FinalGetterFunction =
+        typename RangeBasedContainerInstance::FinalGetterFunction;  ///< Alias for final getter.
+
+    const RangeBasedContainerInstance *m_pContainer;  ///< The corresponding range-based container.
+    std::size_t m_setIndex;               ///< The index of the object set being walked.
+    ContainerIterator m_iterator;         ///< The iterator into the object set being walked.
+    std::size_t m_endSetIndex;            ///< The index of the object set holding the limit.
+    ContainerIterator m_endIterator;      ///< The limit within that object set.
+    std::shared_ptr<TCAST_D> m_spObject;  ///< The cast shared pointer to the current object.
 
-    std::size_t m_index;                              ///< The iterator index.
-    const RangeBasedContainerInstance &m_container;   ///< The corresponding range-based container.
-    const SharedPtrRetriver m_sharedPtrRetriever;     ///< A function to retrieve a shared pointer.
-    const FinalGetterFunction m_finalGetterFunction;  ///< A function to get the final object from
-                                                      ///< the cast shared pointer.
+    /**
+     * @brief Move on to the first object, from the current position onwards, that passes the
+     * container's filters, or to the limit.
+     */
+    void SkipFilteredObjects();
 
 protected:
     /**
      * @brief Constructor.
      *
      * @param container The corresponding range-based container.
-     * @param index The iterator index.
-     * @param sharedPtrRetriever A function to retrieve a shared pointer.
-     * @param finalGetterFunction A function to get the final object from cast shared ptr.
+     * @param setIndex The index of the object set to begin in (past the last set for the end).
+     * @param iterator The iterator into that object set to begin at.
+     * @param endSetIndex The index of the object set holding the limit (past the last set for the
+     * end of the container).
+     * @param endIterator The limit within that object set.
      */
-    RangeBasedIterator(const RangeBasedContainerInstance &container, const std::size_t index,
-                       SharedPtrRetriver sharedPtrRetriever,
-                       FinalGetterFunction finalGetterFunction) noexcept;
+    RangeBasedIterator(const RangeBasedContainerInstance &container, const std::size_t setIndex,
+                       ContainerIterator iterator, const std::size_t endSetIndex,
+                       ContainerIterator endIterator);
 
     friend RangeBasedContainerInstance;  ///< The specialized range-based container.
+    friend RangeBasedChunk<RangeBasedContainerInstance>;  ///< The specialized range-based chunk.
 
 public:
+    using iterator_category = std::forward_iterator_tag;  ///< The iterator category.
+    using reference = std::invoke_result_t<const FinalGetterFunction &,
+                                           const std::shared_ptr<TCAST_D> &>;  ///< The reference.
+    using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;  ///< The value type.
+    using pointer = std::add_pointer_t<std::remove_reference_t<reference>>;  ///< The pointer type.
+    using difference_type = std::ptrdiff_t;  ///< The difference type.
+
+    /**
+     * @brief Default constructor, making a singular iterator that may only be assigned to.
+     */
+    RangeBasedIterator() noexcept;
+
     /**
      * @brief Default copy constructor.
      */
@@ -99,14 +154,14 @@ public:
     RangeBasedIterator(RangeBasedIterator &&) = default;
 
     /**
-     * @brief Deleted copy assignment operator.
+     * @brief Default copy assignment operator.
      */
-    RangeBasedIterator &operator=(const RangeBasedIterator &) = delete;
+    RangeBasedIterator &operator=(const RangeBasedIterator &) = default;
 
     /**
-     * @brief Deleted move assignment operator.
+     * @brief Default move assignment operator.
      */
-    RangeBasedIterator &operator=(RangeBasedIterator &&) = delete;
+    RangeBasedIterator &operator=(RangeBasedIterator &&) = default;
 
     /**
      * @brief Default destructor.
@@ -115,26 +170,131 @@ public:
 
     //----------------------------------------------------------------------------------------------
 
+    /**
+     * @brief Equal-to operator.
+     *
+     * @param other The other RangeBasedIterator object.
+     */
+    bool operator==(const RangeBasedIterator &other) const noexcept;
+
     /**
      * @brief Not-equal-to operator.
      *
      * @param other The other RangeBasedIterator object.
      */
-    auto operator!=(const RangeBasedIterator &other) const noexcept;
+    bool operator!=(const RangeBasedIterator &other) const noexcept;
 
     /**
      * @brief Increment operator.
      *
      * @return The incremented iterator.
      */
-    auto &operator++() noexcept;
+    RangeBasedIterator &operator++();
+
+    /**
+     * @brief Postfix increment operator.
+     *
+     * @return A copy of the iterator from before the increment.
+     */
+    RangeBasedIterator operator++(int);
 
     /**
      * @brief Dereferencing operator.
      *
      * @return A dereferenced object.
      */
-    decltype(auto) operator*() const;
+    reference operator*() const;
+
+    /**
+     * @brief Member access operator.
+     *
+     * @return Pointer to the dereferenced object.
+     */
+    pointer operator->() const;
+};
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief A chunk of a range-based container, i.e. a run of the objects it views, which can be
+ * looped over independently of, and concurrently with, the other chunks. The container must
+ * outlive its chunks, since they rely on the read locks it holds.
+ */
+template <typename TRANGEBASEDCONTAINER>
+class RangeBasedChunk
+{
+private:
+    using RangeBasedContainerInstance =
+        TRANGEBASEDCONTAINER;  ///< Alias for specialized range-based container.
+    using RangeBasedIteratorInstance =
+        typename RangeBasedContainerInstance::RangeBasedIteratorInstance;  ///< Alias for iterator.
+    using ContainerIterator =
+        typename RangeBasedContainerInstance::ContainerIterator;  ///< Alias for set iterator.
+
+    const RangeBasedContainerInstance *m_pContainer;  ///< The corresponding range-based container.
+    std::size_t m_beginSetIndex;        ///< The index of the object set the chunk begins in.
+    ContainerIterator m_beginIterator;  ///< The start of the chunk within that object set.
+    std::size_t m_endSetIndex;          ///< The index of the object set the chunk ends in.
+    ContainerIterator m_endIterator;    ///< The end of the chunk within that object set.
+
+protected:
+    /**
+     * @brief Constructor.
+     *
+     * @param container The corresponding range-based container.
+     * @param beginSetIndex The index of the object set the chunk begins in.
+     * @param beginIterator The start of the chunk within that object set.
+     * @param endSetIndex The index of the object set the chunk ends in.
+     * @param endIterator The end of the chunk within that object set.
+     */
+    RangeBasedChunk(const RangeBasedContainerInstance &container, const std::size_t beginSetIndex,
+                    ContainerIterator beginIterator, const std::size_t endSetIndex,
+                    ContainerIterator endIterator) noexcept;
+
+    friend RangeBasedContainerInstance;  ///< The specialized range-based container.
+
+public:
+    /**
+     * @brief Default copy constructor.
+     */
+    RangeBasedChunk(const RangeBasedChunk &) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    RangeBasedChunk(RangeBasedChunk &&) = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    RangeBasedChunk &operator=(const RangeBasedChunk &) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    RangeBasedChunk &operator=(RangeBasedChunk &&) = default;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~RangeBasedChunk() = default;
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief The chunk begin method.
+     *
+     * @return The iterator at the first object in the chunk.
+     */
+    auto begin() const;
+
+    /**
+     * @brief The chunk end method.
+     *
+     * @return The iterator past the last object in the chunk.
+     */
+    auto end() const;
 };
 
 //--------------------------------------------------------------------------------------------------
@@ -142,9 +302,12 @@ public:
 
 /**
  * @brief A custom container class template for providing range-based for-loops. Particularly
- * useful for abstract base classes.
+ * useful for abstract base classes. It is a lazy view: the object sets it is given are neither
+ * copied nor filtered up front (those passed as temporaries are moved in), and the objects are
+ * filtered as they are iterated over. The read locks it holds keep the viewed sets unchanged.
  */
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
 class RangeBasedContainer
 {
 private:
@@ -167,6 +330,25 @@ private:
     {
     };
 
+    /**
+     * @brief A struct for finding out whether objects of a type can give a shared pointer to
+     * themselves, as registered objects can.
+     */
+    template <typename T, typename = void>
+    struct HasSharedPointerGetter : std::false_type
+    {
+    };
+
+    /**
+     * @brief A struct for finding out whether objects of a type can give a shared pointer to
+     * themselves, as registered objects can.
+     */
+    template <typename T>
+    struct HasSharedPointerGetter<T, std::void_t<decltype(std::declval<T &>().GetSharedPointer())>>
+        : std::true_type
+    {
+    };
+
     using TCONTAINER_D = std::decay_t<TCONTAINER>;        ///< Alias for decayed TCONTAINER type.
     using TINSTANCE = typename TCONTAINER_D::value_type;  ///< Alias for TINSTANCE type.
     using TBASE_D = std::decay_t<TBASE>;                  ///< Alias for decayed TBASE type.
@@ -174,18 +356,20 @@ private:
     using TOBJECT_D = std::decay_t<TOBJECT>;              ///< Alias for decayed TOBJECT type.
 
     using RangeBasedIteratorInstance =
-        RangeBasedIterator<TCONTAINER_D, TBASE_D, TCAST_D,
-                           TOBJECT_D>;  ///< Alias for specialized range-based iterator.
-
-    using ObjectValidityFunction =
-        std::function<bool(const TINSTANCE &)>;  ///< Alias for object validity function.
-    using SharedPtrRetriver = std::function<std::shared_ptr<TBASE_D>(
-        const TINSTANCE &)>;  ///< Alias for shared pointer retriever.
-    using FinalGetterFunction = std::function<TOBJECT_D &(
-        const std::shared_ptr<TCAST_D> &)>;  ///< Alias for final getter function.
-
-    std::size_t m_maxIndex;                           ///< The number of contained objects.
-    TCONTAINER_D m_containedObjects;                  ///< The contained objects.
+        RangeBasedIterator<RangeBasedContainer>;  ///< Alias for specialized range-based iterator.
+    using RangeBasedChunkInstance =
+        RangeBasedChunk<RangeBasedContainer>;  ///< Alias for specialized range-based chunk.
+    using ContainerIterator =
+        typename TCONTAINER_D::const_iterator;  ///< Alias for the underlying container iterator.
+
+    using ObjectValidityFunction = TVALIDITY;  ///< Alias for object validity function.
+    using SharedPtrRetriver = TRETRIEVER;      ///< Alias for shared pointer retriever.
+    using FinalGetterFunction = TGETTER;       ///< Alias for final getter function.
+    using ObjectSetPointers =
+        std::vector<const TCONTAINER_D *>;  ///< Alias for a vector of pointers to object sets.
+
+    std::vector<TCONTAINER_D> m_ownedObjectSets;  ///< The object sets passed as temporaries.
+    ObjectSetPointers m_pObjectSets;  ///< Pointers to the object sets viewed, in iteration order.
     ObjectValidityFunction m_objectValidityFunction;  ///< A function to check instance's validity.
     SharedPtrRetriver m_sharedPtrRetriever;           ///< A function to retrieve a shared pointer.
     FinalGetterFunction m_finalGetterFunction;  ///< A function to get the final object from the
@@ -196,40 +380,18 @@ private:
                            ///< during looping.
 
     /**
-     * @brief Create the object list from the sets of sets by removing all invalid objects.
+     * @brief Add an object set to view, which must outlive the container.
      *
      * @param objectSet The object set.
-     * @param objectSets The object sets.
      */
-    template <typename... TSETS>
-    auto CreateObjectList(const TCONTAINER_D &objectSet, TSETS &&... objectSets) const;
+    void AddObjectSet(const TCONTAINER_D &objectSet);
 
     /**
-     * @brief Create the object list from the set by remove all invalid objects.
+     * @brief Add a temporary object set to view, moving it into the container.
      *
      * @param objectSet The object set.
      */
-    auto CreateObjectList(TCONTAINER_D objectSet) const;
-
-    /**
-     * @brief Insert a value into a container.
-     *
-     * @param container The container.
-     * @param object The value to insert.
-     */
-    template <typename TCONT, typename T>
-    auto InsertIntoContainer(TCONT &container, T &&object) const
-        -> decltype(container.insert(std::forward<T>(object)), void());
-
-    /**
-     * @brief Insert a value into a container.
-     *
-     * @param container The container.
-     * @param object The value to insert.
-     */
-    template <typename TCONT, typename T>
-    auto InsertIntoContainer(TCONT &container, T &&object) const
-        -> decltype(container.push_back(std::forward<T>(object)), void());
+    void AddObjectSet(TCONTAINER_D &&objectSet);
 
 protected:
     /**
@@ -248,7 +410,23 @@ protected:
                         FinalGetterFunction finalGetterFunction, ReadLock readLock1,
                         ReadLock readLock2, TSETS &&... objectSets);
 
+    /**
+     * @brief Constructor, for a number of object sets only known at run time.
+     *
+     * @param objectValidityFunction A function to check instance's validity.
+     * @param sharedPtrRetriever A function to retrieve a shared pointer.
+     * @param finalGetterFunction A function to get the final object from cast shared ptr.
+     * @param readLock1 The first mutex read lock.
+     * @param readLock2 The second mutex read lock.
+     * @param pObjectSets Pointers to the object sets, which must outlive the container.
+     */
+    RangeBasedContainer(ObjectValidityFunction objectValidityFunction,
+                        SharedPtrRetriver sharedPtrRetriever,
+                        FinalGetterFunction finalGetterFunction, ReadLock readLock1,
+                        ReadLock readLock2, ObjectSetPointers pObjectSets);
+
     friend RangeBasedIteratorInstance;  ///< The specialized range-based iterator.
+    friend RangeBasedChunkInstance;     ///< The specialized range-based chunk.
 
     template <typename TA, typename TB>
     friend class RegisteredObjectTemplate;
@@ -259,6 +437,10 @@ protected:
     template <typename TA, typename TB>
     friend class ObjectRegistry;
 
+    template <typename TA, typename TB, typename TC, typename TD, typename TE, typename TF,
+              typename TG, typename... TH>
+    friend auto MakeRangeBasedContainer(TE &&, TF &&, TG &&, ReadLock, ReadLock, TH &&...);
+
 public:
     /**
      * @brief Deleted copy constructor.
@@ -290,32 +472,67 @@ public:
     /**
      * @brief The container begin method.
      *
-     * @return The iterator at index 0.
+     * @return The iterator at the first object.
      */
-    auto begin() const noexcept;
+    auto begin() const;
 
     /**
      * @brief The container end method.
      *
-     * @return The iterator at the maximum index.
+     * @return The iterator past the last object.
      */
     auto end() const noexcept;
 
     /**
-     * @brief The container get method.
+     * @brief The container size method. The objects are filtered lazily, so this counts them.
+     *
+     * @return The number of contained items.
+     */
+    auto size() const;
+
+    /**
+     * @brief The container get method, kept for compatibility. The objects are filtered lazily, so
+     * this walks the container up to the object, and a loop over every index is quadratic in the
+     * number of objects: use ToVector() for repeated random access instead.
+     *
+     * @deprecated Index the vector returned by ToVector() instead.
      *
      * @param index The index of the object to get.
      *
-     * @return The container member.
+     * @return The object.
      */
     decltype(auto) get(const std::size_t index) const;
 
     /**
-     * @brief The container size method.
+     * @brief Copy references to the contained objects into a vector, e.g. for random access. The
+     * references are only guaranteed to stay valid for as long as the container.
      *
-     * @return The number of contained items.
+     * @return The vector of references.
+     */
+    auto ToVector() const;
+
+    /**
+     * @brief Split the container into chunks to loop over in parallel, e.g. one per thread or
+     * several per thread for balance. The chunks hold equal runs of the viewed objects before
+     * filtering, so their loops may yield different numbers of objects. Nothing is copied, but
+     * finding the chunk boundaries in node-based object sets is linear in the number of objects.
+     *
+     * @param nChunks The number of chunks to split into (fewer if there are fewer objects).
+     *
+     * @return The vector of chunks, which must not outlive the container.
+     */
+    auto Split(const std::size_t nChunks) const;
+
+    /**
+     * @brief Take a snapshot of the contained objects, i.e. strong references to them collected up
+     * front, for loops doing long work per object. The snapshot holds no locks, so once this
+     * container is gone (e.g. when the snapshot is taken of a temporary in a range-based for-loop)
+     * other threads can modify the objects' registries and edges during the loop. The objects are
+     * kept alive by the snapshot even if they are deleted meanwhile.
+     *
+     * @return A range-based container over the snapshot.
      */
-    auto size() const noexcept;
+    auto Snapshot() const;
 };
 }  // namespace kl
 
@@ -17,115 +17,200 @@
 
 namespace kl
 {
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
-RangeBasedIterator<TCONTAINER, TBASE, TCAST, TOBJECT>::RangeBasedIterator(
-    const RangeBasedContainerInstance &container, const std::size_t index,
-    SharedPtrRetriver sharedPtrRetriever, FinalGetterFunction finalGetterFunction) noexcept
-    : m_index{index},
-      m_container{container},
-      m_sharedPtrRetriever{std::move(sharedPtrRetriever)},
-      m_finalGetterFunction{std::move(finalGetterFunction)}
+template <typename TRANGEBASEDCONTAINER>
+inline RangeBasedIterator<TRANGEBASEDCONTAINER>::RangeBasedIterator() noexcept
+    : m_pContainer{nullptr},
+      m_setIndex{SIZE_T(0UL)},
+      m_iterator{},
+      m_endSetIndex{SIZE_T(0UL)},
+      m_endIterator{},
+      m_spObject{}
 {
 }
 
 //--------------------------------------------------------------------------------------------------
+
+template <typename TRANGEBASEDCONTAINER>
+RangeBasedIterator<TRANGEBASEDCONTAINER>::RangeBasedIterator(
+    const RangeBasedContainerInstance &container, const std::size_t setIndex,
+    ContainerIterator iterator, const std::size_t endSetIndex, ContainerIterator endIterator)
+    : m_pContainer{&container},
+      m_setIndex{setIndex},
+      m_iterator{std::move(iterator)},
+      m_endSetIndex{endSetIndex},
+      m_endIterator{std::move(endIterator)},
+      m_spObject{}
+{
+    this->SkipFilteredObjects();
+}
+
 //--------------------------------------------------------------------------------------------------
 
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
-inline auto RangeBasedIterator<TCONTAINER, TBASE, TCAST, TOBJECT>::operator!=(
+template <typename TRANGEBASEDCONTAINER>
+void RangeBasedIterator<TRANGEBASEDCONTAINER>::SkipFilteredObjects()
+{
+    const auto &pObjectSets = m_pContainer->m_pObjectSets;
+
+    while (m_setIndex < pObjectSets.size())
+    {
+        const auto isEndSet = (m_setIndex == m_endSetIndex);
+        const auto endIter = isEndSet ? m_endIterator : pObjectSets[m_setIndex]->cend();
+
+        for (; m_iterator != endIter; ++m_iterator)
+        {
+            // Expired objects fail the cast, so the validity function only sees live ones.
+            auto spObject =
+                std::dynamic_pointer_cast<TCAST_D>(m_pContainer->m_sharedPtrRetriever(*m_iterator));
+
+            if (spObject && m_pContainer->m_objectValidityFunction(*m_iterator))
+            {
+                m_spObject = std::move(spObject);
+                return;
+            }
+        }
+
+        // Stopping at the limit leaves the iterator equal to the corresponding end iterator.
+        if (isEndSet) break;
+
+        if (++m_setIndex < pObjectSets.size()) m_iterator = pObjectSets[m_setIndex]->cbegin();
+    }
+
+    if (m_setIndex >= pObjectSets.size()) m_iterator = ContainerIterator{};
+    m_spObject.reset();
+}
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+template <typename TRANGEBASEDCONTAINER>
+inline bool RangeBasedIterator<TRANGEBASEDCONTAINER>::operator==(
+    const RangeBasedIterator &other) const noexcept
+{
+    return !(*this != other);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TRANGEBASEDCONTAINER>
+inline bool RangeBasedIterator<TRANGEBASEDCONTAINER>::operator!=(
     const RangeBasedIterator &other) const noexcept
 {
-    return (m_index != other.m_index);
+    if (m_setIndex != other.m_setIndex) return true;
+
+    // Iterators past the last set hold no underlying iterator to compare.
+    return (m_setIndex < m_pContainer->m_pObjectSets.size()) && (m_iterator != other.m_iterator);
 }
 
 //--------------------------------------------------------------------------------------------------
 
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
-inline auto &RangeBasedIterator<TCONTAINER, TBASE, TCAST, TOBJECT>::operator++() noexcept
+template <typename TRANGEBASEDCONTAINER>
+inline auto RangeBasedIterator<TRANGEBASEDCONTAINER>::operator++() -> RangeBasedIterator &
 {
-    ++m_index;
+    ++m_iterator;
+    this->SkipFilteredObjects();
+
     return *this;
 }
 
 //--------------------------------------------------------------------------------------------------
 
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
-inline decltype(auto) RangeBasedIterator<TCONTAINER, TBASE, TCAST, TOBJECT>::operator*() const
+template <typename TRANGEBASEDCONTAINER>
+inline auto RangeBasedIterator<TRANGEBASEDCONTAINER>::operator++(int) -> RangeBasedIterator
 {
-    if (const auto spObject = m_sharedPtrRetriever(m_container.get(m_index)))
-        return m_finalGetterFunction(std::dynamic_pointer_cast<TCAST_D>(spObject));
+    auto iterator = *this;
+    ++(*this);
 
-    KL_THROW("Failed to retrieve shared pointer to object during loop");
+    return iterator;
 }
 
 //--------------------------------------------------------------------------------------------------
+
+template <typename TRANGEBASEDCONTAINER>
+inline auto RangeBasedIterator<TRANGEBASEDCONTAINER>::operator*() const -> reference
+{
+    if (m_spObject) return m_pContainer->m_finalGetterFunction(m_spObject);
+
+    KL_THROW("Failed to retrieve shared pointer to object during loop");
+}
+
 //--------------------------------------------------------------------------------------------------
 
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
-template <typename... TSETS>
-auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT>::CreateObjectList(
-    const TCONTAINER_D &objectSet, TSETS &&... objectSets) const
+template <typename TRANGEBASEDCONTAINER>
+inline auto RangeBasedIterator<TRANGEBASEDCONTAINER>::operator->() const -> pointer
 {
-    auto objectList = this->CreateObjectList(objectSet);
-    auto otherObjectsList = this->CreateObjectList(std::forward<TSETS>(objectSets)...);
+    return std::addressof(**this);
+}
 
-    for (auto &&object : otherObjectsList) this->InsertIntoContainer(objectList, object);
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
 
-    return objectList;
+template <typename TRANGEBASEDCONTAINER>
+RangeBasedChunk<TRANGEBASEDCONTAINER>::RangeBasedChunk(
+    const RangeBasedContainerInstance &container, const std::size_t beginSetIndex,
+    ContainerIterator beginIterator, const std::size_t endSetIndex,
+    ContainerIterator endIterator) noexcept
+    : m_pContainer{&container},
+      m_beginSetIndex{beginSetIndex},
+      m_beginIterator{std::move(beginIterator)},
+      m_endSetIndex{endSetIndex},
+      m_endIterator{std::move(endIterator)}
+{
 }
 
 //--------------------------------------------------------------------------------------------------
 
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
-auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT>::CreateObjectList(
-    TCONTAINER_D objectSet) const
+template <typename TRANGEBASEDCONTAINER>
+inline auto RangeBasedChunk<TRANGEBASEDCONTAINER>::begin() const
 {
-    for (auto iter = objectSet.cbegin(); iter != objectSet.cend(); /* no iterator */)
-    {
-        if (!std::dynamic_pointer_cast<TCAST_D>(m_sharedPtrRetriever(*iter)) ||
-            !m_objectValidityFunction(*iter))
-            iter = objectSet.erase(iter);
+    return RangeBasedIteratorInstance{*m_pContainer, m_beginSetIndex, m_beginIterator,
+                                      m_endSetIndex, m_endIterator};
+}
 
-        else
-            ++iter;
-    }
+//--------------------------------------------------------------------------------------------------
 
-    return objectSet;
+template <typename TRANGEBASEDCONTAINER>
+inline auto RangeBasedChunk<TRANGEBASEDCONTAINER>::end() const
+{
+    return RangeBasedIteratorInstance{*m_pContainer, m_endSetIndex, m_endIterator, m_endSetIndex,
+                                      m_endIterator};
 }
 
+//--------------------------------------------------------------------------------------------------
 //--------------------------------------------------------------------------------------------------
 
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
-template <typename TCONT, typename T>
-inline auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT>::InsertIntoContainer(
-    TCONT &container, T &&object) const
-    -> decltype(container.insert(std::forward<T>(object)), void())
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
+inline void RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT, TVALIDITY, TRETRIEVER,
+                                TGETTER>::AddObjectSet(const TCONTAINER_D &objectSet)
 {
-    container.insert(std::forward<T>(object));
+    m_pObjectSets.push_back(&objectSet);
 }
 
 //--------------------------------------------------------------------------------------------------
 
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
-template <typename TCONT, typename T>
-inline auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT>::InsertIntoContainer(
-    TCONT &container, T &&object) const
-    -> decltype(container.push_back(std::forward<T>(object)), void())
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
+inline void RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT, TVALIDITY, TRETRIEVER,
+                                TGETTER>::AddObjectSet(TCONTAINER_D &&objectSet)
 {
-    container.push_back(std::forward<T>(object));
+    // The owned sets are reserved up front, so pointers to them are never invalidated.
+    m_ownedObjectSets.push_back(std::move(objectSet));
+    m_pObjectSets.push_back(&m_ownedObjectSets.back());
 }
 
 //--------------------------------------------------------------------------------------------------
 //--------------------------------------------------------------------------------------------------
 
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
 template <typename... TSETS>
-RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT>::RangeBasedContainer(
+RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT, TVALIDITY, TRETRIEVER,
+                    TGETTER>::RangeBasedContainer(
     ObjectValidityFunction objectValidityFunction, SharedPtrRetriver sharedPtrRetriever,
     FinalGetterFunction finalGetterFunction, ReadLock readLock1, ReadLock readLock2,
     TSETS &&... objectSets)
-    : m_maxIndex{SIZE_T(0UL)},
-      m_containedObjects{},
+    : m_ownedObjectSets{},
+      m_pObjectSets{},
       m_objectValidityFunction{std::move(objectValidityFunction)},
       m_sharedPtrRetriever{std::move(sharedPtrRetriever)},
       m_finalGetterFunction{std::move(finalGetterFunction)},
@@ -136,44 +221,205 @@ RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT>::RangeBasedContainer(
     static_assert(TypeExpanderCondType<std::is_same<std::decay_t<TSETS>, TCONTAINER_D>...>::value,
                   "Not all sets passed to the range based container were of the type TCONTAINER");
 
-    m_containedObjects = this->CreateObjectList(std::forward<TSETS>(objectSets)...);
-    m_maxIndex = m_containedObjects.size();
+    m_ownedObjectSets.reserve(sizeof...(TSETS));
+    m_pObjectSets.reserve(sizeof...(TSETS));
+    (this->AddObjectSet(std::forward<TSETS>(objectSets)), ...);
 }
 
 //--------------------------------------------------------------------------------------------------
+
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
+RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT, TVALIDITY, TRETRIEVER,
+                    TGETTER>::RangeBasedContainer(
+    ObjectValidityFunction objectValidityFunction, SharedPtrRetriver sharedPtrRetriever,
+    FinalGetterFunction finalGetterFunction, ReadLock readLock1, ReadLock readLock2,
+    ObjectSetPointers pObjectSets)
+    : m_ownedObjectSets{},
+      m_pObjectSets{std::move(pObjectSets)},
+      m_objectValidityFunction{std::move(objectValidityFunction)},
+      m_sharedPtrRetriever{std::move(sharedPtrRetriever)},
+      m_finalGetterFunction{std::move(finalGetterFunction)},
+      m_readLock1{std::move(readLock1)},
+      m_readLock2{std::move(readLock2)}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
+inline auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT, TVALIDITY, TRETRIEVER,
+                                TGETTER>::begin() const
+{
+    const auto nSets = m_pObjectSets.size();
+    return RangeBasedIteratorInstance{
+        *this, SIZE_T(0UL), nSets ? m_pObjectSets.front()->cbegin() : ContainerIterator{}, nSets,
+        ContainerIterator{}};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
+inline auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT, TVALIDITY, TRETRIEVER,
+                                TGETTER>::end() const noexcept
+{
+    const auto nSets = m_pObjectSets.size();
+    return RangeBasedIteratorInstance{*this, nSets, ContainerIterator{}, nSets,
+                                      ContainerIterator{}};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
+inline auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT, TVALIDITY, TRETRIEVER,
+                                TGETTER>::size() const
+{
+    auto nObjects = SIZE_T(0UL);
+    for (auto iter = this->begin(), endIter = this->end(); iter != endIter; ++iter) ++nObjects;
+
+    return nObjects;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
+decltype(auto) RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT, TVALIDITY, TRETRIEVER,
+                                   TGETTER>::get(const std::size_t index) const
+{
+    auto position = SIZE_T(0UL);
+
+    for (auto iter = this->begin(), endIter = this->end(); iter != endIter; ++iter)
+    {
+        if (position++ == index) return *iter;
+    }
+
+    KL_THROW("Could not get object " << index << " of a range-based container holding only "
+                                     << position << " objects");
+}
+
 //--------------------------------------------------------------------------------------------------
 
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
-inline auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT>::begin() const noexcept
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
+auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT, TVALIDITY, TRETRIEVER,
+                         TGETTER>::ToVector() const
 {
-    return RangeBasedIteratorInstance{*this, SIZE_T(0UL), m_sharedPtrRetriever,
-                                      m_finalGetterFunction};
+    auto objects = std::vector<std::reference_wrapper<TOBJECT_D>>{};
+    for (auto &object : *this) objects.emplace_back(object);
+
+    return objects;
 }
 
 //--------------------------------------------------------------------------------------------------
 
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
-inline auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT>::end() const noexcept
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
+auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT, TVALIDITY, TRETRIEVER,
+                         TGETTER>::Split(const std::size_t nChunks) const
 {
-    return RangeBasedIteratorInstance{*this, m_maxIndex, m_sharedPtrRetriever,
-                                      m_finalGetterFunction};
+    KL_ASSERT(nChunks > SIZE_T(0UL), "Cannot split a range-based container into zero chunks");
+
+    auto nInstances = SIZE_T(0UL);
+    for (const auto pObjectSet : m_pObjectSets) nInstances += pObjectSet->size();
+
+    const auto chunkSize = std::max(SIZE_T(1UL), (nInstances + nChunks - SIZE_T(1UL)) / nChunks);
+
+    auto chunks = std::vector<RangeBasedChunkInstance>{};
+    chunks.reserve(std::min(nChunks, nInstances));
+
+    // Walk the object sets once, marking where each chunk ends and the next begins.
+    auto setIndex = SIZE_T(0UL);
+    auto setPosition = SIZE_T(0UL);
+    auto iterator = m_pObjectSets.empty() ? ContainerIterator{} : m_pObjectSets.front()->cbegin();
+
+    for (auto nRemaining = nInstances; nRemaining > SIZE_T(0UL);)
+    {
+        const auto beginSetIndex = setIndex;
+        const auto beginIterator = iterator;
+
+        auto nToAdvance = std::min(chunkSize, nRemaining);
+        nRemaining -= nToAdvance;
+
+        while (nToAdvance > SIZE_T(0UL))
+        {
+            while (setPosition == m_pObjectSets[setIndex]->size())
+            {
+                iterator = m_pObjectSets[++setIndex]->cbegin();
+                setPosition = SIZE_T(0UL);
+            }
+
+            const auto nSteps = std::min(nToAdvance, m_pObjectSets[setIndex]->size() - setPosition);
+            std::advance(iterator,
+                         static_cast<typename std::iterator_traits<
+                             ContainerIterator>::difference_type>(nSteps));
+
+            setPosition += nSteps;
+            nToAdvance -= nSteps;
+        }
+
+        chunks.push_back(
+            RangeBasedChunkInstance{*this, beginSetIndex, beginIterator, setIndex, iterator});
+    }
+
+    return chunks;
 }
 
 //--------------------------------------------------------------------------------------------------
 
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
-inline decltype(auto) RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT>::get(
-    const std::size_t index) const
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER>
+auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT, TVALIDITY, TRETRIEVER,
+                         TGETTER>::Snapshot() const
 {
-    return *std::next(m_containedObjects.cbegin(), static_cast<std::int32_t>(index));
+    using TOBJECT_sPtr = std::shared_ptr<TOBJECT_D>;
+    using TOBJECT_sPtrVector = std::vector<TOBJECT_sPtr>;
+
+    auto spObjects = TOBJECT_sPtrVector{};
+
+    for (auto iter = this->begin(), endIter = this->end(); iter != endIter; ++iter)
+    {
+        auto &object = *iter;
+
+        // Registered objects keep themselves alive; otherwise the object is reached through the
+        // cast object (e.g. a pseudo-edge), which then has to be kept alive in its stead.
+        if constexpr (HasSharedPointerGetter<TOBJECT_D>::value)
+            spObjects.emplace_back(object.GetSharedPointer(), &object);
+
+        else
+            spObjects.emplace_back(iter.m_spObject, &object);
+    }
+
+    return MakeRangeBasedContainer<TOBJECT_sPtrVector, TOBJECT_D, TOBJECT_D, TOBJECT_D>(
+        [](const TOBJECT_sPtr &) { return true; },
+        [](const TOBJECT_sPtr &spObject) { return spObject; },
+        [](const TOBJECT_sPtr &spObject) -> auto & { return *spObject; }, ReadLock{}, ReadLock{},
+        std::move(spObjects));
 }
 
+//--------------------------------------------------------------------------------------------------
 //--------------------------------------------------------------------------------------------------
 
-template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT>
-inline auto RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT>::size() const noexcept
+template <typename TCONTAINER, typename TBASE, typename TCAST, typename TOBJECT,
+          typename TVALIDITY, typename TRETRIEVER, typename TGETTER, typename... TSETS>
+auto MakeRangeBasedContainer(TVALIDITY &&objectValidityFunction, TRETRIEVER &&sharedPtrRetriever,
+                             TGETTER &&finalGetterFunction, ReadLock readLock1,
+                             ReadLock readLock2, TSETS &&... objectSets)
 {
-    return m_containedObjects.size();
+    using RangeBasedContainerInstance =
+        RangeBasedContainer<TCONTAINER, TBASE, TCAST, TOBJECT, std::decay_t<TVALIDITY>,
+                            std::decay_t<TRETRIEVER>, std::decay_t<TGETTER>>;
+
+    return RangeBasedContainerInstance{std::forward<TVALIDITY>(objectValidityFunction),
+                                       std::forward<TRETRIEVER>(sharedPtrRetriever),
+                                       std::forward<TGETTER>(finalGetterFunction),
+                                       std::move(readLock1),
+                                       std::move(readLock2),
+                                       std::forward<TSETS>(objectSets)...};
 }
 }  // namespace kl
 
@@ -0,0 +1,108 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/include/koala/Registry/AliasIndex.h
+ *
+ * @brief Header file for the alias index traits (AliasIndexTraits) class template.
+ */
+
+#ifndef KL_ALIAS_INDEX_H
+#define KL_ALIAS_INDEX_H 1
+
+#include "koala/Definitions.h"
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace kl
+{
+/**
+ * @brief AliasIndexTraits class template. Chooses the key and the container of the alias-to-ID
+ * index of a registry with a given alias type. The index is hashed unless KOALA_ORDERED_ALIAS_INDEX
+ * is defined, and may be replaced for a given alias type by specializing this template. A key must
+ * remain valid for as long as the alias from which it was made.
+ */
+template <typename TALIAS>
+struct AliasIndexTraits
+{
+    using Key = TALIAS;  ///< Alias for the index key type.
+
+#ifdef KOALA_ORDERED_ALIAS_INDEX
+    using Index = std::map<Key, ID_t>;  ///< Alias for the index type.
+#else
+    using Index = std::unordered_map<Key, ID_t>;  ///< Alias for the index type.
+#endif  // #ifdef KOALA_ORDERED_ALIAS_INDEX
+
+    /**
+     * @brief Whether objects of a given type may be used to look up aliases.
+     */
+    template <typename T>
+    using IsLookupKey = std::is_same<std::decay_t<T>, TALIAS>;
+
+    /**
+     * @brief Make the index key for an alias.
+     *
+     * @param alias The alias.
+     *
+     * @return The index key.
+     */
+    static const Key &MakeKey(const TALIAS &alias) noexcept;
+};
+
+/**
+ * @brief AliasIndexTraits class template specialization for string aliases. The index is keyed by
+ * views of the alias strings held by the registry, so each alias is stored once and may be looked
+ * up by anything convertible to a string view without allocating.
+ */
+template <>
+struct AliasIndexTraits<std::string>
+{
+    using Key = std::string_view;  ///< Alias for the index key type.
+
+#ifdef KOALA_ORDERED_ALIAS_INDEX
+    using Index = std::map<Key, ID_t>;  ///< Alias for the index type.
+#else
+    using Index = std::unordered_map<Key, ID_t>;  ///< Alias for the index type.
+#endif  // #ifdef KOALA_ORDERED_ALIAS_INDEX
+
+    /**
+     * @brief Whether objects of a given type may be used to look up aliases.
+     */
+    template <typename T>
+    using IsLookupKey = std::is_convertible<T, std::string_view>;
+
+    /**
+     * @brief Make the index key for an alias.
+     *
+     * @param alias The alias.
+     *
+     * @return The index key.
+     */
+    static Key MakeKey(const std::string &alias) noexcept;
+};
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+template <typename TALIAS>
+inline auto AliasIndexTraits<TALIAS>::MakeKey(const TALIAS &alias) noexcept -> const Key &
+{
+    return alias;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto AliasIndexTraits<std::string>::MakeKey(const std::string &alias) noexcept -> Key
+{
+    return alias;
+}
+}  // namespace kl
+
+#endif  // #ifndef KL_ALIAS_INDEX_H
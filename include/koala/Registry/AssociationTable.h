@@ -0,0 +1,903 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/include/koala/Registry/AssociationTable.h
+ *
+ * @brief Header file for the registry association table (AssociationTable) class.
+ */
+
+#ifndef KL_ASSOCIATION_TABLE_H
+#define KL_ASSOCIATION_TABLE_H 1
+
+#include "koala/Definitions.h"
+#include "koala/Lock.h"
+#include "koala/Registry/MemoryReport.h"
+#include "koala/Registry/TypeTag.h"
+
+#include <algorithm>
+#include <any>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace kl
+{
+/**
+ * @brief AssociationTable class. A compact store of the associations formed by the objects of a
+ * registry, held as one row per association in parallel arrays of source IDs, target IDs, target
+ * type tags and interned indicator indices, rather than as a shared pointer and set entries per
+ * association. Rows are kept sorted by source ID behind an array of adjacency offsets, one per
+ * source with rows, so the associations of an object are enumerated contiguously; new rows go to an
+ * unsorted tail, indexed by source ID, that is folded into the sorted rows once it grows large.
+ * Indicators of any equality-comparable type are interned once per table; string-like indicators
+ * are all interned as strings, and the empty string stands for no indicator. Only rows from a
+ * deleted source are removed when it is deleted, so rows may name deleted targets, which the
+ * registered objects skip when they resolve the targets.
+ */
+class AssociationTable
+{
+public:
+    using IndicatorIndex = std::uint32_t;  ///< Alias for the index of an interned indicator.
+
+    /**
+     * @brief IndicatorTraits class template, giving the type in which indicators of a given type
+     * are stored and the key by which they are looked up.
+     */
+    template <typename TINDICATOR, typename = void>
+    struct IndicatorTraits
+    {
+        using Stored = TINDICATOR;  ///< Alias for the stored indicator type.
+
+        /**
+         * @brief Get the lookup key of an indicator.
+         *
+         * @param indicator The indicator.
+         *
+         * @return The key.
+         */
+        static auto &Key(const TINDICATOR &indicator) noexcept { return indicator; }
+    };
+
+    /**
+     * @brief IndicatorTraits class template specialization for string-like indicators, which are
+     * stored as strings and looked up by view.
+     */
+    template <typename TINDICATOR>
+    struct IndicatorTraits<
+        TINDICATOR,
+        std::enable_if_t<std::is_convertible<const TINDICATOR &, std::string_view>::value>>
+    {
+        using Stored = std::string;  ///< Alias for the stored indicator type.
+
+        /**
+         * @brief Get the lookup key of an indicator.
+         *
+         * @param indicator The indicator.
+         *
+         * @return The key.
+         */
+        static auto Key(const TINDICATOR &indicator) noexcept
+        {
+            return std::string_view{indicator};
+        }
+    };
+
+    /**
+     * @brief Default constructor.
+     */
+    AssociationTable() noexcept;
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    AssociationTable(const AssociationTable &) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    AssociationTable(AssociationTable &&) = delete;
+
+    /**
+     * @brief Deleted copy assignment operator.
+     */
+    AssociationTable &operator=(const AssociationTable &) = delete;
+
+    /**
+     * @brief Deleted move assignment operator.
+     */
+    AssociationTable &operator=(AssociationTable &&) = delete;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~AssociationTable() = default;
+
+    /**
+     * @brief Form an association from a source object to a target object.
+     *
+     * @param sourceId The ID of the source object.
+     * @param targetId The ID of the target object.
+     * @param typeTag The tag of the target object's type.
+     * @param indicator The indicator (an empty string for none).
+     *
+     * @return Whether the association was formed (false if it already existed).
+     */
+    template <typename TINDICATOR = std::string>
+    auto Associate(const ID_t sourceId, const ID_t targetId, const TypeTag typeTag,
+                   const TINDICATOR &indicator = TINDICATOR{});
+
+    /**
+     * @brief Dissolve an association from a source object to a target object.
+     *
+     * @param sourceId The ID of the source object.
+     * @param targetId The ID of the target object.
+     * @param typeTag The tag of the target object's type.
+     * @param indicator The indicator (an empty string for none).
+     *
+     * @return Whether the association was dissolved (false if it did not exist).
+     */
+    template <typename TINDICATOR = std::string>
+    auto Dissociate(const ID_t sourceId, const ID_t targetId, const TypeTag typeTag,
+                    const TINDICATOR &indicator = TINDICATOR{}) noexcept;
+
+    /**
+     * @brief Dissolve every association from a source object to a target object, whatever its
+     * indicator.
+     *
+     * @param sourceId The ID of the source object.
+     * @param targetId The ID of the target object.
+     * @param typeTag The tag of the target object's type.
+     *
+     * @return The number of associations dissolved.
+     */
+    auto DissociateTarget(const ID_t sourceId, const ID_t targetId, const TypeTag typeTag) noexcept;
+
+    /**
+     * @brief Dissolve every association from a source object.
+     *
+     * @param sourceId The ID of the source object.
+     *
+     * @return The number of associations dissolved.
+     */
+    auto DissociateAll(const ID_t sourceId) noexcept;
+
+    /**
+     * @brief Dissolve every association.
+     */
+    void Clear() noexcept;
+
+    /**
+     * @brief Find out whether a source object is associated with any target of a given type.
+     *
+     * @param sourceId The ID of the source object.
+     * @param typeTag The tag of the target type.
+     *
+     * @return Whether any such association exists.
+     */
+    auto IsAssociated(const ID_t sourceId, const TypeTag typeTag) const;
+
+    /**
+     * @brief Find out whether a source object is associated with any target of a given type, with
+     * a given indicator.
+     *
+     * @param sourceId The ID of the source object.
+     * @param typeTag The tag of the target type.
+     * @param indicator The indicator (an empty string for none).
+     *
+     * @return Whether any such association exists.
+     */
+    template <typename TINDICATOR>
+    auto IsAssociated(const ID_t sourceId, const TypeTag typeTag,
+                      const TINDICATOR &indicator) const;
+
+    /**
+     * @brief Get the IDs of the targets of a given type associated with a source object.
+     *
+     * @param sourceId The ID of the source object.
+     * @param typeTag The tag of the target type.
+     *
+     * @return The target IDs.
+     */
+    auto GetTargetIds(const ID_t sourceId, const TypeTag typeTag) const;
+
+    /**
+     * @brief Get the IDs of the targets of a given type associated with a source object with a
+     * given indicator.
+     *
+     * @param sourceId The ID of the source object.
+     * @param typeTag The tag of the target type.
+     * @param indicator The indicator (an empty string for none).
+     *
+     * @return The target IDs.
+     */
+    template <typename TINDICATOR>
+    auto GetTargetIds(const ID_t sourceId, const TypeTag typeTag,
+                      const TINDICATOR &indicator) const;
+
+    /**
+     * @brief Call a function on every association from a source object, under the table's read
+     * lock (so the function must neither modify the table nor lock a registry, which deletes from
+     * the table under its own locks).
+     *
+     * @param sourceId The ID of the source object.
+     * @param function The function, taking the target ID, the target type tag, whether there is an
+     * indicator and the indicator string.
+     */
+    template <typename TFUNCTION>
+    void ForEachAssociation(const ID_t sourceId, TFUNCTION &&function) const;
+
+    /**
+     * @brief Fold the unsorted rows into the sorted rows and drop the dissolved rows, leaving every
+     * association behind the adjacency offsets.
+     */
+    void Compact();
+
+    /**
+     * @brief Get the number of associations.
+     *
+     * @return The number of associations.
+     */
+    auto Size() const noexcept;
+
+    /**
+     * @brief Get the bytes held by the table, its rows, offsets and interned indicators.
+     *
+     * @return The bytes.
+     */
+    auto MemoryBytes() const noexcept;
+
+private:
+    /**
+     * @brief InternedIndicator struct, holding an interned indicator and the means to print it.
+     */
+    struct InternedIndicator
+    {
+        std::any m_value;                                  ///< The indicator, as stored.
+        std::string (*m_pToString)(const std::any &value);  ///< Prints the stored indicator.
+    };
+
+    /**
+     * @brief A struct for finding out whether indicators of a type can be hashed.
+     */
+    template <typename T, typename = void>
+    struct IsHashable : std::false_type
+    {
+    };
+
+    /**
+     * @brief A struct for finding out whether indicators of a type can be hashed.
+     */
+    template <typename T>
+    struct IsHashable<T, std::void_t<decltype(std::hash<T>{}(std::declval<const T &>()))>>
+        : std::true_type
+    {
+    };
+
+    using InternedIndicatorVector =
+        std::vector<InternedIndicator>;  ///< Alias for a vector of interned indicators.
+    using IndicatorIndexMap = std::unordered_multimap<
+        std::size_t, IndicatorIndex>;  ///< Alias for the indicator indices by indicator hash.
+    using TailIndex = std::unordered_multimap<ID_t, std::size_t>;  ///< Alias for the tail index.
+
+    static constexpr auto MIN_TAIL_ROWS = SIZE_T(64UL);  ///< The tail rows always left unfolded.
+    static constexpr auto NO_INDICATOR = IndicatorIndex{0U};  ///< The index of the empty indicator.
+    static constexpr auto UNKNOWN_INDICATOR =
+        IndicatorIndex{~0U};  ///< The index of an indicator never interned.
+
+    /**
+     * @brief Hash an indicator key. Keys that cannot be hashed all share a hash of zero, so they
+     * are told apart by comparison alone.
+     *
+     * @param key The indicator key.
+     *
+     * @return The hash.
+     */
+    template <typename TKEY>
+    static auto HashIndicator(const TKEY &key) noexcept -> std::size_t;
+
+    /**
+     * @brief Print a stored indicator, if it is a string or a number.
+     *
+     * @param value The stored indicator.
+     *
+     * @return The indicator string (empty if it cannot be printed).
+     */
+    template <typename TSTORED>
+    static auto PrintIndicator(const std::any &value) -> std::string;
+
+    /**
+     * @brief Get the index of an interned indicator, interning it if need be.
+     *
+     * @param indicator The indicator.
+     *
+     * @return The indicator index.
+     */
+    template <typename TINDICATOR>
+    auto InternIndicator(const TINDICATOR &indicator) -> IndicatorIndex;
+
+    /**
+     * @brief Look up the index of an interned indicator.
+     *
+     * @param indicator The indicator.
+     *
+     * @return The indicator index (unknown if it was never interned).
+     */
+    template <typename TINDICATOR>
+    auto FindIndicator(const TINDICATOR &indicator) const noexcept -> IndicatorIndex;
+
+    /**
+     * @brief Find the sorted rows from a source object.
+     *
+     * @param sourceId The ID of the source object.
+     *
+     * @return The first sorted row from the source and one past its last (equal if there are none).
+     */
+    auto FindSortedRows(const ID_t sourceId) const noexcept -> std::pair<std::size_t, std::size_t>;
+
+    /**
+     * @brief Make room for one more row in every column, so that appending it cannot throw.
+     */
+    void ReserveRow();
+
+    /**
+     * @brief Call a function on the position of every live row from a source object, until it
+     * returns true.
+     *
+     * @param sourceId The ID of the source object.
+     * @param function The function, taking the row position and returning whether to stop.
+     *
+     * @return Whether the function returned true.
+     */
+    template <typename TFUNCTION>
+    auto FindRow(const ID_t sourceId, TFUNCTION &&function) const;
+
+    /**
+     * @brief Dissolve the row at a position.
+     *
+     * @param position The row position.
+     */
+    void RemoveRow(const std::size_t position) noexcept;
+
+    /**
+     * @brief Fold the unsorted rows into the sorted rows with a stable sort on source ID, dropping
+     * the dissolved rows.
+     */
+    void Fold();
+
+    mutable kl::Mutex m_mutex;  ///< A mutex for locking the table during concurrent access.
+
+    IdVector m_sourceIds;                          ///< The source object ID of each row.
+    IdVector m_targetIds;                          ///< The target object ID of each row.
+    std::vector<TypeTag> m_typeTags;               ///< The target type tag (unknown if dissolved).
+    std::vector<IndicatorIndex> m_indicatorIndices;  ///< The indicator index of each row.
+
+    IdVector m_sortedSourceIds;          ///< The distinct source IDs of the sorted rows, ascending.
+    std::vector<std::size_t> m_offsets;  ///< The first sorted row of each of them, and one past.
+    std::size_t m_nSortedRows;           ///< The number of rows sorted by source ID.
+    TailIndex m_tailIndex;               ///< The positions of the live unsorted rows by source ID.
+    std::size_t m_nRemovedRows;          ///< The number of dissolved rows not yet dropped.
+
+    InternedIndicatorVector m_indicators;  ///< The interned indicators by index.
+    IndicatorIndexMap m_indicatorIndexMap;  ///< The indices of the interned indicators by hash.
+};
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+inline AssociationTable::AssociationTable() noexcept
+    : m_mutex{},
+      m_sourceIds{},
+      m_targetIds{},
+      m_typeTags{},
+      m_indicatorIndices{},
+      m_sortedSourceIds{},
+      m_offsets{},
+      m_nSortedRows{SIZE_T(0UL)},
+      m_tailIndex{},
+      m_nRemovedRows{SIZE_T(0UL)},
+      m_indicators{},
+      m_indicatorIndexMap{}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TKEY>
+inline auto AssociationTable::HashIndicator(const TKEY &key) noexcept -> std::size_t
+{
+    if constexpr (IsHashable<TKEY>::value)
+    {
+        return std::hash<TKEY>{}(key);
+    }
+
+    else
+    {
+        static_cast<void>(key);
+        return SIZE_T(0UL);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TSTORED>
+inline auto AssociationTable::PrintIndicator(const std::any &value) -> std::string
+{
+    const auto &indicator = *std::any_cast<TSTORED>(&value);
+
+    if constexpr (std::is_constructible<std::string, const TSTORED &>::value)
+    {
+        return std::string{indicator};
+    }
+
+    else if constexpr (std::is_arithmetic<TSTORED>::value)
+    {
+        return std::to_string(indicator);
+    }
+
+    else
+    {
+        static_cast<void>(indicator);
+        return std::string{};
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TINDICATOR>
+inline auto AssociationTable::InternIndicator(const TINDICATOR &indicator) -> IndicatorIndex
+{
+    using Traits = IndicatorTraits<TINDICATOR>;
+    using TSTORED = typename Traits::Stored;
+
+    if (m_indicators.empty())
+    {
+        m_indicators.push_back(
+            InternedIndicator{std::any{std::string{}}, &PrintIndicator<std::string>});
+        m_indicatorIndexMap.emplace(HashIndicator(std::string_view{}), NO_INDICATOR);
+    }
+
+    const auto foundIndex = this->FindIndicator(indicator);
+    if (foundIndex != UNKNOWN_INDICATOR) return foundIndex;
+
+    if (m_indicators.size() >= static_cast<std::size_t>(UNKNOWN_INDICATOR))
+        KL_THROW("Could not intern association indicator: too many indicators");
+
+    const auto indicatorIndex = static_cast<IndicatorIndex>(m_indicators.size());
+    m_indicators.push_back(InternedIndicator{
+        std::any{std::in_place_type<TSTORED>, Traits::Key(indicator)}, &PrintIndicator<TSTORED>});
+
+    try
+    {
+        m_indicatorIndexMap.emplace(HashIndicator(Traits::Key(indicator)), indicatorIndex);
+    }
+    catch (...)
+    {
+        m_indicators.pop_back();
+        throw;
+    }
+
+    return indicatorIndex;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TINDICATOR>
+inline auto AssociationTable::FindIndicator(const TINDICATOR &indicator) const noexcept
+    -> IndicatorIndex
+{
+    using Traits = IndicatorTraits<TINDICATOR>;
+
+    // Indicators of different types may share a hash, so each candidate's type is checked too.
+    const auto &key = Traits::Key(indicator);
+    const auto [findBegin, findEnd] = m_indicatorIndexMap.equal_range(HashIndicator(key));
+
+    for (auto findIter = findBegin; findIter != findEnd; ++findIter)
+    {
+        const auto pStored =
+            std::any_cast<typename Traits::Stored>(&m_indicators[findIter->second].m_value);
+        if (pStored && (*pStored == key)) return findIter->second;
+    }
+
+    return UNKNOWN_INDICATOR;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto AssociationTable::FindSortedRows(const ID_t sourceId) const noexcept
+    -> std::pair<std::size_t, std::size_t>
+{
+    const auto findIter =
+        std::lower_bound(m_sortedSourceIds.cbegin(), m_sortedSourceIds.cend(), sourceId);
+
+    if ((findIter == m_sortedSourceIds.cend()) || (*findIter != sourceId))
+        return {SIZE_T(0UL), SIZE_T(0UL)};
+
+    const auto sourceIndex = static_cast<std::size_t>(findIter - m_sortedSourceIds.cbegin());
+    return {m_offsets[sourceIndex], m_offsets[sourceIndex + SIZE_T(1UL)]};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void AssociationTable::ReserveRow()
+{
+    if (m_sourceIds.size() < m_sourceIds.capacity()) return;
+
+    // Every column is reserved before any is appended to, so a failure leaves them all unchanged;
+    // the capacity grows geometrically, as push_back would grow it.
+    const auto capacity = std::max(MIN_TAIL_ROWS, SIZE_T(2UL) * m_sourceIds.size());
+
+    m_sourceIds.reserve(capacity);
+    m_targetIds.reserve(capacity);
+    m_typeTags.reserve(capacity);
+    m_indicatorIndices.reserve(capacity);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TFUNCTION>
+auto AssociationTable::FindRow(const ID_t sourceId, TFUNCTION &&function) const
+{
+    const auto [sortedBegin, sortedEnd] = this->FindSortedRows(sourceId);
+
+    for (auto position = sortedBegin; position < sortedEnd; ++position)
+    {
+        if ((m_typeTags[position] != UNKNOWN_TYPE_TAG) && function(position)) return true;
+    }
+
+    const auto [tailBegin, tailEnd] = m_tailIndex.equal_range(sourceId);
+
+    for (auto tailIter = tailBegin; tailIter != tailEnd; ++tailIter)
+    {
+        if (function(tailIter->second)) return true;
+    }
+
+    return false;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void AssociationTable::RemoveRow(const std::size_t position) noexcept
+{
+    m_typeTags[position] = UNKNOWN_TYPE_TAG;
+    ++m_nRemovedRows;
+
+    if (position < m_nSortedRows) return;
+
+    const auto [tailBegin, tailEnd] = m_tailIndex.equal_range(m_sourceIds[position]);
+
+    for (auto tailIter = tailBegin; tailIter != tailEnd; ++tailIter)
+    {
+        if (tailIter->second != position) continue;
+
+        m_tailIndex.erase(tailIter);
+        break;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TINDICATOR>
+inline auto AssociationTable::Associate(const ID_t sourceId, const ID_t targetId,
+                                        const TypeTag typeTag, const TINDICATOR &indicator)
+{
+    if (typeTag == UNKNOWN_TYPE_TAG) KL_THROW("Could not associate with an object of unknown type");
+
+    const auto lock = WriteLock{m_mutex};
+    const auto indicatorIndex = this->InternIndicator(indicator);
+
+    const auto isFound = this->FindRow(sourceId, [&](const std::size_t position) {
+        return (m_targetIds[position] == targetId) && (m_typeTags[position] == typeTag) &&
+               (m_indicatorIndices[position] == indicatorIndex);
+    });
+
+    if (isFound) return false;
+
+    this->ReserveRow();
+    m_sourceIds.push_back(sourceId);
+    m_targetIds.push_back(targetId);
+    m_typeTags.push_back(typeTag);
+    m_indicatorIndices.push_back(indicatorIndex);
+
+    try
+    {
+        m_tailIndex.emplace(sourceId, m_sourceIds.size() - SIZE_T(1UL));
+    }
+    catch (...)
+    {
+        this->RemoveRow(m_sourceIds.size() - SIZE_T(1UL));
+        throw;
+    }
+
+    // Dissolved rows cannot be dropped by Dissociate, which must not throw, so they go here too.
+    if ((m_tailIndex.size() > std::max(MIN_TAIL_ROWS, m_nSortedRows / SIZE_T(8UL))) ||
+        (m_nRemovedRows > std::max(MIN_TAIL_ROWS, m_sourceIds.size() / SIZE_T(2UL))))
+    {
+        this->Fold();
+    }
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TINDICATOR>
+inline auto AssociationTable::Dissociate(const ID_t sourceId, const ID_t targetId,
+                                         const TypeTag typeTag,
+                                         const TINDICATOR &indicator) noexcept
+{
+    const auto lock = WriteLock{m_mutex};
+    const auto indicatorIndex = this->FindIndicator(indicator);
+    if (indicatorIndex == UNKNOWN_INDICATOR) return false;
+
+    auto foundPosition = SIZE_T(0UL);
+    const auto isFound = this->FindRow(sourceId, [&](const std::size_t position) {
+        foundPosition = position;
+        return (m_targetIds[position] == targetId) && (m_typeTags[position] == typeTag) &&
+               (m_indicatorIndices[position] == indicatorIndex);
+    });
+
+    if (!isFound) return false;
+
+    this->RemoveRow(foundPosition);
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto AssociationTable::DissociateTarget(const ID_t sourceId, const ID_t targetId,
+                                               const TypeTag typeTag) noexcept
+{
+    const auto lock = WriteLock{m_mutex};
+    auto nDissociated = SIZE_T(0UL);
+
+    // Removing a row from the tail invalidates the search, so each removal starts a new one.
+    while (true)
+    {
+        auto foundPosition = SIZE_T(0UL);
+        const auto isFound = this->FindRow(sourceId, [&](const std::size_t position) {
+            foundPosition = position;
+            return (m_targetIds[position] == targetId) && (m_typeTags[position] == typeTag);
+        });
+
+        if (!isFound) return nDissociated;
+
+        this->RemoveRow(foundPosition);
+        ++nDissociated;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto AssociationTable::DissociateAll(const ID_t sourceId) noexcept
+{
+    const auto lock = WriteLock{m_mutex};
+    auto nDissociated = SIZE_T(0UL);
+    const auto [sortedBegin, sortedEnd] = this->FindSortedRows(sourceId);
+
+    for (auto position = sortedBegin; position < sortedEnd; ++position)
+    {
+        if (m_typeTags[position] == UNKNOWN_TYPE_TAG) continue;
+
+        m_typeTags[position] = UNKNOWN_TYPE_TAG;
+        ++m_nRemovedRows;
+        ++nDissociated;
+    }
+
+    const auto [tailBegin, tailEnd] = m_tailIndex.equal_range(sourceId);
+
+    for (auto tailIter = tailBegin; tailIter != tailEnd; ++tailIter)
+    {
+        m_typeTags[tailIter->second] = UNKNOWN_TYPE_TAG;
+        ++m_nRemovedRows;
+        ++nDissociated;
+    }
+
+    m_tailIndex.erase(tailBegin, tailEnd);
+    return nDissociated;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void AssociationTable::Clear() noexcept
+{
+    const auto lock = WriteLock{m_mutex};
+
+    m_sourceIds.clear();
+    m_targetIds.clear();
+    m_typeTags.clear();
+    m_indicatorIndices.clear();
+    m_sortedSourceIds.clear();
+    m_offsets.clear();
+    m_nSortedRows = SIZE_T(0UL);
+    m_tailIndex.clear();
+    m_nRemovedRows = SIZE_T(0UL);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto AssociationTable::IsAssociated(const ID_t sourceId, const TypeTag typeTag) const
+{
+    const auto lock = ReadLock{m_mutex};
+
+    return this->FindRow(sourceId, [&](const std::size_t position) {
+        return m_typeTags[position] == typeTag;
+    });
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TINDICATOR>
+inline auto AssociationTable::IsAssociated(const ID_t sourceId, const TypeTag typeTag,
+                                           const TINDICATOR &indicator) const
+{
+    const auto lock = ReadLock{m_mutex};
+    const auto indicatorIndex = this->FindIndicator(indicator);
+    if (indicatorIndex == UNKNOWN_INDICATOR) return false;
+
+    return this->FindRow(sourceId, [&](const std::size_t position) {
+        return (m_typeTags[position] == typeTag) &&
+               (m_indicatorIndices[position] == indicatorIndex);
+    });
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto AssociationTable::GetTargetIds(const ID_t sourceId, const TypeTag typeTag) const
+{
+    const auto lock = ReadLock{m_mutex};
+    auto targetIds = IdVector{};
+
+    this->FindRow(sourceId, [&](const std::size_t position) {
+        if (m_typeTags[position] == typeTag) targetIds.push_back(m_targetIds[position]);
+        return false;
+    });
+
+    return targetIds;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TINDICATOR>
+inline auto AssociationTable::GetTargetIds(const ID_t sourceId, const TypeTag typeTag,
+                                           const TINDICATOR &indicator) const
+{
+    const auto lock = ReadLock{m_mutex};
+    auto targetIds = IdVector{};
+
+    const auto indicatorIndex = this->FindIndicator(indicator);
+    if (indicatorIndex == UNKNOWN_INDICATOR) return targetIds;
+
+    this->FindRow(sourceId, [&](const std::size_t position) {
+        if ((m_typeTags[position] == typeTag) && (m_indicatorIndices[position] == indicatorIndex))
+            targetIds.push_back(m_targetIds[position]);
+
+        return false;
+    });
+
+    return targetIds;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TFUNCTION>
+void AssociationTable::ForEachAssociation(const ID_t sourceId, TFUNCTION &&function) const
+{
+    const auto lock = ReadLock{m_mutex};
+
+    this->FindRow(sourceId, [&](const std::size_t position) {
+        const auto indicatorIndex = m_indicatorIndices[position];
+        const auto &interned = m_indicators[indicatorIndex];
+
+        function(m_targetIds[position], m_typeTags[position], (indicatorIndex != NO_INDICATOR),
+                 interned.m_pToString(interned.m_value));
+        return false;
+    });
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void AssociationTable::Compact()
+{
+    const auto lock = WriteLock{m_mutex};
+    if (!m_tailIndex.empty() || (m_nRemovedRows > SIZE_T(0UL))) this->Fold();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto AssociationTable::Size() const noexcept
+{
+    const auto lock = ReadLock{m_mutex};
+    return m_sourceIds.size() - m_nRemovedRows;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto AssociationTable::MemoryBytes() const noexcept
+{
+    const auto lock = ReadLock{m_mutex};
+
+    auto memoryBytes = sizeof(AssociationTable) - sizeof(kl::Mutex) + VectorBytes(m_sourceIds) +
+                       VectorBytes(m_targetIds) + VectorBytes(m_typeTags) +
+                       VectorBytes(m_indicatorIndices) +
+                       VectorBytes(m_sortedSourceIds) + VectorBytes(m_offsets) +
+                       HashContainerBytes(m_tailIndex) + HashContainerBytes(m_indicatorIndexMap) +
+                       VectorBytes(m_indicators);
+
+    // Only the heap held by string indicators is known; other indicators count their size alone.
+    for (const auto &interned : m_indicators)
+    {
+        if (const auto pString = std::any_cast<std::string>(&interned.m_value))
+            memoryBytes += OwnedBytes(*pString);
+    }
+
+    return memoryBytes;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void AssociationTable::Fold()
+{
+    // Order the live rows by source; the sort is stable, so each source's rows keep the order in
+    // which they were formed.
+    auto livePositions = std::vector<std::size_t>{};
+    livePositions.reserve(m_sourceIds.size() - m_nRemovedRows);
+
+    for (auto position = SIZE_T(0UL); position < m_sourceIds.size(); ++position)
+    {
+        if (m_typeTags[position] != UNKNOWN_TYPE_TAG) livePositions.push_back(position);
+    }
+
+    std::stable_sort(livePositions.begin(), livePositions.end(),
+                     [this](const std::size_t lhs, const std::size_t rhs) {
+                         return m_sourceIds[lhs] < m_sourceIds[rhs];
+                     });
+
+    // The offsets are indexed by the rank of each source with rows rather than by its ID, since IDs
+    // are never reused and would leave the offsets as long as the highest ID ever issued.
+    const auto nRows = livePositions.size();
+    auto sourceIds = IdVector(nRows);
+    auto targetIds = IdVector(nRows);
+    auto typeTags = std::vector<TypeTag>(nRows);
+    auto indicatorIndices = std::vector<IndicatorIndex>(nRows);
+    auto sortedSourceIds = IdVector{};
+    auto offsets = std::vector<std::size_t>{};
+
+    for (auto newPosition = SIZE_T(0UL); newPosition < nRows; ++newPosition)
+    {
+        const auto position = livePositions[newPosition];
+        sourceIds[newPosition] = m_sourceIds[position];
+        targetIds[newPosition] = m_targetIds[position];
+        typeTags[newPosition] = m_typeTags[position];
+        indicatorIndices[newPosition] = m_indicatorIndices[position];
+
+        if (sortedSourceIds.empty() || (sortedSourceIds.back() != sourceIds[newPosition]))
+        {
+            sortedSourceIds.push_back(sourceIds[newPosition]);
+            offsets.push_back(newPosition);
+        }
+    }
+
+    offsets.push_back(nRows);
+
+    m_sourceIds = std::move(sourceIds);
+    m_targetIds = std::move(targetIds);
+    m_typeTags = std::move(typeTags);
+    m_indicatorIndices = std::move(indicatorIndices);
+    m_sortedSourceIds = std::move(sortedSourceIds);
+    m_offsets = std::move(offsets);
+    m_nSortedRows = nRows;
+    m_tailIndex.clear();
+    m_nRemovedRows = SIZE_T(0UL);
+}
+}  // namespace kl
+
+#endif  // #ifndef KL_ASSOCIATION_TABLE_H
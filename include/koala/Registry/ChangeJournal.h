@@ -0,0 +1,258 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/include/koala/Registry/ChangeJournal.h
+ *
+ * @brief Header file for the registry change journal (ChangeJournal) class.
+ */
+
+#ifndef KL_CHANGE_JOURNAL_H
+#define KL_CHANGE_JOURNAL_H 1
+
+#include "koala/Definitions.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace kl
+{
+/**
+ * @brief ChangeJournal class. A bounded, lock-free ring buffer of the changes made to a registry,
+ * from which any number of consumers read at their own pace through their own cursors. Writers
+ * never wait for consumers: once a consumer falls more than the capacity behind, the changes it
+ * missed are overwritten and it is told so, at which point it must rescan the registry.
+ */
+class ChangeJournal
+{
+public:
+    using sPtr = std::shared_ptr<ChangeJournal>;  ///< Alias for a shared pointer to the journal.
+
+    /**
+     * @brief Enum enumerating the kinds of change.
+     */
+    enum class CHANGE : std::uint8_t
+    {
+        CREATED,      ///< An object was created.
+        DELETED,      ///< An object was deleted.
+        ALIAS_ADDED,  ///< An alias was added to an object.
+        CLEARED       ///< Every object was deleted (the object ID is meaningless).
+    };
+
+    /**
+     * @brief Entry struct, describing one change.
+     */
+    struct Entry
+    {
+        std::uint64_t m_sequence;  ///< The sequence number of the change.
+        CHANGE m_change;           ///< The kind of change.
+        ID_t m_objectId;           ///< The ID of the changed object.
+    };
+
+    /**
+     * @brief Constructor.
+     *
+     * @param capacity The number of changes kept (rounded up to a power of two).
+     */
+    explicit ChangeJournal(const std::size_t capacity);
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    ChangeJournal(const ChangeJournal &) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    ChangeJournal(ChangeJournal &&) = delete;
+
+    /**
+     * @brief Deleted copy assignment operator.
+     */
+    ChangeJournal &operator=(const ChangeJournal &) = delete;
+
+    /**
+     * @brief Deleted move assignment operator.
+     */
+    ChangeJournal &operator=(ChangeJournal &&) = delete;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~ChangeJournal() = default;
+
+    /**
+     * @brief Record a change.
+     *
+     * @param change The kind of change.
+     * @param objectId The ID of the changed object.
+     */
+    void Record(const CHANGE change, const ID_t objectId) noexcept;
+
+    /**
+     * @brief Call a function on every change recorded since a cursor, in sequence order, and move
+     * the cursor past them. Reading stops early at a change that is still being recorded, which
+     * the next read picks up.
+     *
+     * @param cursor The sequence number of the next change to read (zero for a new consumer).
+     * @param function The function, taking a const reference to the entry.
+     *
+     * @return Whether every change since the cursor was read (false if some were overwritten).
+     */
+    template <typename TFUNCTION>
+    auto Read(std::uint64_t &cursor, TFUNCTION &&function) const;
+
+    /**
+     * @brief Get the sequence number of the next change to be recorded, from which a consumer that
+     * has just scanned the registry may start reading.
+     *
+     * @return The sequence number.
+     */
+    auto NextSequence() const noexcept;
+
+    /**
+     * @brief Get the number of changes kept.
+     *
+     * @return The capacity.
+     */
+    auto Capacity() const noexcept;
+
+    /**
+     * @brief Get the bytes held by the journal and its ring of slots.
+     *
+     * @return The bytes.
+     */
+    auto MemoryBytes() const noexcept;
+
+private:
+    /**
+     * @brief Slot struct, holding one change behind a sequence lock.
+     */
+    struct Slot
+    {
+        std::atomic<std::uint64_t> m_sequence{0U};  ///< The sequence number plus one (0 if busy).
+        std::atomic<CHANGE> m_change{CHANGE::CREATED};  ///< The kind of change.
+        std::atomic<ID_t> m_objectId{0U};               ///< The ID of the changed object.
+    };
+
+    /**
+     * @brief Round a capacity up to a power of two.
+     *
+     * @param capacity The capacity.
+     *
+     * @return The rounded capacity.
+     */
+    static auto RoundCapacity(const std::size_t capacity) noexcept;
+
+    std::size_t m_capacity;                    ///< The number of changes kept.
+    std::unique_ptr<Slot[]> m_slots;           ///< The ring of slots.
+    std::atomic<std::uint64_t> m_nextSequence;  ///< The sequence number of the next change.
+};
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+inline auto ChangeJournal::RoundCapacity(const std::size_t capacity) noexcept
+{
+    auto roundedCapacity = SIZE_T(1UL);
+    while (roundedCapacity < capacity) roundedCapacity <<= SIZE_T(1UL);
+
+    return roundedCapacity;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline ChangeJournal::ChangeJournal(const std::size_t capacity)
+    : m_capacity{ChangeJournal::RoundCapacity(capacity)},
+      m_slots{std::make_unique<Slot[]>(m_capacity)},
+      m_nextSequence{0U}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void ChangeJournal::Record(const CHANGE change, const ID_t objectId) noexcept
+{
+    const auto sequence = m_nextSequence.fetch_add(1U, std::memory_order_relaxed);
+    auto &slot = m_slots[sequence & (m_capacity - SIZE_T(1UL))];
+
+    // Mark the slot busy before overwriting it, so that readers can tell a torn read.
+    slot.m_sequence.store(0U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.m_change.store(change, std::memory_order_relaxed);
+    slot.m_objectId.store(objectId, std::memory_order_relaxed);
+    slot.m_sequence.store(sequence + 1U, std::memory_order_release);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TFUNCTION>
+auto ChangeJournal::Read(std::uint64_t &cursor, TFUNCTION &&function) const
+{
+    const auto nextSequence = m_nextSequence.load(std::memory_order_acquire);
+    auto isComplete = true;
+
+    if (nextSequence - cursor > m_capacity)
+    {
+        cursor = nextSequence - m_capacity;
+        isComplete = false;
+    }
+
+    for (; cursor < nextSequence; ++cursor)
+    {
+        const auto &slot = m_slots[cursor & (m_capacity - SIZE_T(1UL))];
+
+        const auto slotSequence = slot.m_sequence.load(std::memory_order_acquire);
+        const auto entry = Entry{cursor, slot.m_change.load(std::memory_order_relaxed),
+                                 slot.m_objectId.load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if ((slotSequence != cursor + 1U) ||
+            (slot.m_sequence.load(std::memory_order_relaxed) != slotSequence))
+        {
+            // A later sequence number means the change was overwritten; anything else means it is
+            // still being recorded (or overwritten, which the next read will find out).
+            if (slotSequence > cursor + 1U)
+            {
+                isComplete = false;
+                continue;
+            }
+
+            break;
+        }
+
+        function(static_cast<const Entry &>(entry));
+    }
+
+    return isComplete;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto ChangeJournal::NextSequence() const noexcept
+{
+    return m_nextSequence.load(std::memory_order_acquire);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto ChangeJournal::Capacity() const noexcept
+{
+    return m_capacity;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto ChangeJournal::MemoryBytes() const noexcept
+{
+    return sizeof(ChangeJournal) + m_capacity * sizeof(Slot);
+}
+}  // namespace kl
+
+#endif  // #ifndef KL_CHANGE_JOURNAL_H
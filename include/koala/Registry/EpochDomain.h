@@ -0,0 +1,361 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/include/koala/Registry/EpochDomain.h
+ *
+ * @brief Header file for the reader epoch domain (EpochDomain) class.
+ */
+
+#ifndef KL_EPOCH_DOMAIN_H
+#define KL_EPOCH_DOMAIN_H 1
+
+#include "koala/Definitions.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace kl
+{
+/**
+ * @brief EpochDomain class. Epoch-based reclamation for data read without locks: each reader
+ * announces the global epoch in a slot of its own for the duration of a read, and a writer that
+ * has unpublished some data waits in Synchronize until every reader that might still see it has
+ * moved on, after which the data can be released. Reads never write to memory shared with other
+ * readers. Each thread is given a slot on first use; threads beyond the number of slots are
+ * refused and must fall back to locking.
+ */
+class EpochDomain
+{
+private:
+    static constexpr auto CACHE_LINE_SIZE = SIZE_T(64UL);  ///< The assumed cache line size.
+
+    /**
+     * @brief ReaderSlot struct, holding the epoch announced by one thread, alone in its cache line.
+     */
+    struct alignas(CACHE_LINE_SIZE) ReaderSlot
+    {
+        std::atomic<std::size_t> m_epoch{0UL};  ///< The announced epoch (zero if not reading).
+        std::size_t m_depth = 0UL;  ///< The number of nested reads (touched only by the owner).
+    };
+
+public:
+    static constexpr auto MAX_READERS = SIZE_T(128UL);  ///< The number of reader slots.
+
+    /**
+     * @brief ReadGuard class, announcing a reader epoch for as long as it lives.
+     */
+    class ReadGuard
+    {
+    public:
+        /**
+         * @brief Default constructor, making an inactive guard.
+         */
+        ReadGuard() noexcept = default;
+
+        /**
+         * @brief Deleted copy constructor.
+         */
+        ReadGuard(const ReadGuard &) = delete;
+
+        /**
+         * @brief Move constructor.
+         *
+         * @param other The guard to move from, which becomes inactive.
+         */
+        ReadGuard(ReadGuard &&other) noexcept;
+
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        ReadGuard &operator=(const ReadGuard &) = delete;
+
+        /**
+         * @brief Deleted move assignment operator.
+         */
+        ReadGuard &operator=(ReadGuard &&) = delete;
+
+        /**
+         * @brief Destructor, leaving the epoch.
+         */
+        ~ReadGuard();
+
+        /**
+         * @brief Find out whether the guard announced an epoch, without which nothing read is safe.
+         *
+         * @return Whether the guard is active.
+         */
+        auto IsActive() const noexcept;
+
+    private:
+        /**
+         * @brief Constructor.
+         *
+         * @param pReaderSlot Pointer to the slot in which the epoch was announced.
+         */
+        explicit ReadGuard(ReaderSlot *const pReaderSlot) noexcept;
+
+        ReaderSlot *m_pReaderSlot = nullptr;  ///< Pointer to the slot (null if inactive).
+
+        friend class EpochDomain;
+    };
+
+    /**
+     * @brief Constructor.
+     */
+    EpochDomain();
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    EpochDomain(const EpochDomain &) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    EpochDomain(EpochDomain &&) = delete;
+
+    /**
+     * @brief Deleted copy assignment operator.
+     */
+    EpochDomain &operator=(const EpochDomain &) = delete;
+
+    /**
+     * @brief Deleted move assignment operator.
+     */
+    EpochDomain &operator=(EpochDomain &&) = delete;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~EpochDomain() = default;
+
+    /**
+     * @brief Enter the current epoch, before reading any published pointer. Reads may be nested.
+     *
+     * @return The guard (inactive if the thread could not be given a slot).
+     */
+    auto Enter() const noexcept -> ReadGuard;
+
+    /**
+     * @brief Find out whether the calling thread is reading, having entered an epoch not yet left.
+     *
+     * @return Whether the calling thread is reading.
+     */
+    auto IsReading() const noexcept;
+
+    /**
+     * @brief Wait until every reader that entered before the call has left, so that anything
+     * unpublished before the call can be released (note: must not be called by a reader).
+     */
+    void Synchronize() const noexcept;
+
+    /**
+     * @brief Get the bytes held by the domain and its reader slots.
+     *
+     * @return The bytes.
+     */
+    auto MemoryBytes() const noexcept;
+
+private:
+    /**
+     * @brief ThreadIndex class, claiming a process-wide index for a thread until it exits.
+     */
+    class ThreadIndex
+    {
+    public:
+        /**
+         * @brief Constructor, claiming the lowest free index.
+         */
+        ThreadIndex() noexcept;
+
+        /**
+         * @brief Deleted copy constructor.
+         */
+        ThreadIndex(const ThreadIndex &) = delete;
+
+        /**
+         * @brief Deleted move constructor.
+         */
+        ThreadIndex(ThreadIndex &&) = delete;
+
+        /**
+         * @brief Deleted copy assignment operator.
+         */
+        ThreadIndex &operator=(const ThreadIndex &) = delete;
+
+        /**
+         * @brief Deleted move assignment operator.
+         */
+        ThreadIndex &operator=(ThreadIndex &&) = delete;
+
+        /**
+         * @brief Destructor, releasing the index.
+         */
+        ~ThreadIndex();
+
+        /**
+         * @brief Get the index of the calling thread.
+         *
+         * @return The index (MAX_READERS if every index was taken).
+         */
+        static auto Get() noexcept;
+
+    private:
+        /**
+         * @brief Get the flags marking which indices are claimed.
+         *
+         * @return The flags.
+         */
+        static auto &ClaimedIndices() noexcept;
+
+        std::size_t m_index;  ///< The claimed index (MAX_READERS if none).
+    };
+
+    mutable std::atomic<std::size_t> m_epoch;  ///< The global epoch (readers announce it).
+    std::unique_ptr<ReaderSlot[]> m_readerSlots;  ///< The reader slots, indexed by thread index.
+};
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+inline EpochDomain::ReadGuard::ReadGuard(ReaderSlot *const pReaderSlot) noexcept
+    : m_pReaderSlot{pReaderSlot}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline EpochDomain::ReadGuard::ReadGuard(ReadGuard &&other) noexcept
+    : m_pReaderSlot{std::exchange(other.m_pReaderSlot, nullptr)}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline EpochDomain::ReadGuard::~ReadGuard()
+{
+    if (m_pReaderSlot && (--m_pReaderSlot->m_depth == SIZE_T(0UL)))
+        m_pReaderSlot->m_epoch.store(SIZE_T(0UL), std::memory_order_release);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto EpochDomain::ReadGuard::IsActive() const noexcept
+{
+    return (m_pReaderSlot != nullptr);
+}
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+inline auto &EpochDomain::ThreadIndex::ClaimedIndices() noexcept
+{
+    static std::array<std::atomic<bool>, MAX_READERS> claimedIndices{};
+    return claimedIndices;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline EpochDomain::ThreadIndex::ThreadIndex() noexcept : m_index{MAX_READERS}
+{
+    auto &claimedIndices = ThreadIndex::ClaimedIndices();
+
+    for (auto index = SIZE_T(0UL); index < MAX_READERS; ++index)
+    {
+        if (!claimedIndices[index].exchange(true, std::memory_order_acquire))
+        {
+            m_index = index;
+            break;
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline EpochDomain::ThreadIndex::~ThreadIndex()
+{
+    if (m_index < MAX_READERS)
+        ThreadIndex::ClaimedIndices()[m_index].store(false, std::memory_order_release);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto EpochDomain::ThreadIndex::Get() noexcept
+{
+    thread_local const ThreadIndex threadIndex{};
+    return threadIndex.m_index;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline EpochDomain::EpochDomain()
+    : m_epoch{SIZE_T(1UL)}, m_readerSlots{std::make_unique<ReaderSlot[]>(MAX_READERS)}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto EpochDomain::Enter() const noexcept -> ReadGuard
+{
+    const auto threadIndex = ThreadIndex::Get();
+    if (threadIndex >= MAX_READERS) return ReadGuard{};
+
+    // The announcement must be visible before any published pointer is read (sequentially
+    // consistently, as the writers read the slots).
+    auto &readerSlot = m_readerSlots[threadIndex];
+
+    if (readerSlot.m_depth++ == SIZE_T(0UL))
+    {
+        const auto epoch = m_epoch.load(std::memory_order_relaxed);
+        readerSlot.m_epoch.store(epoch, std::memory_order_seq_cst);
+    }
+
+    return ReadGuard{&readerSlot};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto EpochDomain::IsReading() const noexcept
+{
+    const auto threadIndex = ThreadIndex::Get();
+    return (threadIndex < MAX_READERS) && (m_readerSlots[threadIndex].m_depth > SIZE_T(0UL));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void EpochDomain::Synchronize() const noexcept
+{
+    // Readers entering from now on announce a later epoch, so only earlier ones are waited for.
+    const auto epoch = m_epoch.fetch_add(SIZE_T(1UL), std::memory_order_seq_cst);
+
+    for (auto index = SIZE_T(0UL); index < MAX_READERS; ++index)
+    {
+        const auto &readerSlot = m_readerSlots[index];
+
+        while (true)
+        {
+            const auto readerEpoch = readerSlot.m_epoch.load(std::memory_order_seq_cst);
+            if ((readerEpoch == SIZE_T(0UL)) || (readerEpoch > epoch)) break;
+
+            std::this_thread::yield();
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto EpochDomain::MemoryBytes() const noexcept
+{
+    return sizeof(EpochDomain) + MAX_READERS * sizeof(ReaderSlot);
+}
+}  // namespace kl
+
+#endif  // #ifndef KL_EPOCH_DOMAIN_H
@@ -0,0 +1,208 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/include/koala/Registry/Handle.h
+ *
+ * @brief Header file for the registered object handle (Handle) class template.
+ */
+
+#ifndef KL_HANDLE_H
+#define KL_HANDLE_H 1
+
+#include "koala/Definitions.h"
+
+#include <functional>
+#include <limits>
+
+namespace kl
+{
+/**
+ * @brief Handle class template. A compact, trivially copyable and trivially hashable reference to a
+ * registered object of a given type, which the object registry validates and dereferences in
+ * constant time without touching any reference count. IDs are never reused, so the ID serves as
+ * both the slot index and the generation: a handle to a deleted object never resolves to another
+ * object.
+ */
+template <typename TOBJECT>
+class Handle
+{
+public:
+    using Object = TOBJECT;  ///< Alias for the type of the object.
+
+    /**
+     * @brief Default constructor, making a null handle.
+     */
+    constexpr Handle() noexcept;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param objectId The ID of the object.
+     */
+    constexpr explicit Handle(const ID_t objectId) noexcept;
+
+    /**
+     * @brief Converting constructor from a handle to an object of a derived type.
+     *
+     * @param other The other handle.
+     */
+    template <typename TOTHER,
+              typename = std::enable_if_t<std::is_base_of<TOBJECT, TOTHER>::value &&
+                                          !std::is_same<TOBJECT, TOTHER>::value>>
+    constexpr Handle(const Handle<TOTHER> &other) noexcept;
+
+    /**
+     * @brief Get the ID of the object.
+     *
+     * @return The ID of the object.
+     */
+    constexpr auto ID() const noexcept;
+
+    /**
+     * @brief Find out whether the handle is non-null (it may still refer to a deleted object).
+     *
+     * @return Whether the handle is non-null.
+     */
+    constexpr explicit operator bool() const noexcept;
+
+    /**
+     * @brief Equality operator.
+     *
+     * @param other The other handle.
+     *
+     * @return Whether the handles refer to the same object.
+     */
+    constexpr bool operator==(const Handle &other) const noexcept;
+
+    /**
+     * @brief Inequality operator.
+     *
+     * @param other The other handle.
+     *
+     * @return Whether the handles refer to different objects.
+     */
+    constexpr bool operator!=(const Handle &other) const noexcept;
+
+    /**
+     * @brief Less-than operator, ordering handles by ID.
+     *
+     * @param other The other handle.
+     *
+     * @return Whether this handle comes before the other.
+     */
+    constexpr bool operator<(const Handle &other) const noexcept;
+
+private:
+    static constexpr auto NULL_ID = std::numeric_limits<ID_t>::max();  ///< The ID of a null handle.
+
+    ID_t m_id;  ///< The ID of the object.
+};
+
+/**
+ * @brief IsHandle class template. Whether a type is a handle.
+ */
+template <typename T>
+struct IsHandle : std::false_type
+{
+};
+
+/**
+ * @brief IsHandle class template specialization for handles.
+ */
+template <typename TOBJECT>
+struct IsHandle<Handle<TOBJECT>> : std::true_type
+{
+};
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT>
+constexpr Handle<TOBJECT>::Handle() noexcept : m_id{NULL_ID}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT>
+constexpr Handle<TOBJECT>::Handle(const ID_t objectId) noexcept : m_id{objectId}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT>
+template <typename TOTHER, typename>
+constexpr Handle<TOBJECT>::Handle(const Handle<TOTHER> &other) noexcept : m_id{other.ID()}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT>
+constexpr auto Handle<TOBJECT>::ID() const noexcept
+{
+    return m_id;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT>
+constexpr Handle<TOBJECT>::operator bool() const noexcept
+{
+    return (m_id != NULL_ID);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT>
+constexpr bool Handle<TOBJECT>::operator==(const Handle &other) const noexcept
+{
+    return (m_id == other.m_id);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT>
+constexpr bool Handle<TOBJECT>::operator!=(const Handle &other) const noexcept
+{
+    return (m_id != other.m_id);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT>
+constexpr bool Handle<TOBJECT>::operator<(const Handle &other) const noexcept
+{
+    return (m_id < other.m_id);
+}
+}  // namespace kl
+
+namespace std
+{
+/**
+ * @brief Hash class template specialization for handles, hashing the ID.
+ */
+template <typename TOBJECT>
+struct hash<kl::Handle<TOBJECT>>
+{
+    /**
+     * @brief Hash a handle.
+     *
+     * @param handle The handle.
+     *
+     * @return The hash.
+     */
+    std::size_t operator()(const kl::Handle<TOBJECT> &handle) const noexcept
+    {
+        return std::hash<kl::ID_t>{}(handle.ID());
+    }
+};
+}  // namespace std
+
+#endif  // #ifndef KL_HANDLE_H
@@ -0,0 +1,244 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/include/koala/Registry/MemoryReport.h
+ *
+ * @brief Header file for the memory report (MemoryReport) struct and the estimators used to fill
+ * it in.
+ */
+
+#ifndef KL_MEMORY_REPORT_H
+#define KL_MEMORY_REPORT_H 1
+
+#include "koala/Definitions.h"
+
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace kl
+{
+/**
+ * @brief MemoryReport struct, estimating the bytes taken up by a registry, an object or a whole
+ * Koala instance, by category. The estimates assume typical standard library node layouts and
+ * ignore allocator overhead, so they are for sizing and tracking regressions rather than exact.
+ */
+struct MemoryReport
+{
+    std::size_t m_objectBytes = 0UL;       ///< The object payloads, less their mutexes.
+    std::size_t m_indexBytes = 0UL;        ///< The registry slots, type buckets and alias maps.
+    std::size_t m_associationBytes = 0UL;  ///< The association tables and associations.
+    std::size_t m_edgeBytes = 0UL;         ///< The edges, pseudo-edges and hierarchy sets.
+    std::size_t m_mutexBytes = 0UL;        ///< The registry, shard and object mutexes.
+
+    /**
+     * @brief Addition assignment operator, accumulating another report.
+     *
+     * @param other The other report.
+     *
+     * @return This report.
+     */
+    MemoryReport &operator+=(const MemoryReport &other) noexcept;
+
+    /**
+     * @brief Get the total bytes across all categories.
+     *
+     * @return The total bytes.
+     */
+    auto TotalBytes() const noexcept;
+};
+
+/**
+ * @brief The estimated bytes of a shared pointer control block.
+ */
+constexpr auto CONTROL_BLOCK_BYTES = SIZE_T(2UL) * sizeof(long) + sizeof(void *);
+
+/**
+ * @brief Estimate the heap bytes of a node-based hash container: its bucket array and its nodes,
+ * each holding a value, a link and a cached hash.
+ *
+ * @param container The container.
+ *
+ * @return The estimated bytes.
+ */
+template <typename TCONTAINER>
+auto HashContainerBytes(const TCONTAINER &container) noexcept;
+
+/**
+ * @brief Estimate the heap bytes of a node-based tree container: its nodes, each holding a value,
+ * three links and a colour.
+ *
+ * @param container The container.
+ *
+ * @return The estimated bytes.
+ */
+template <typename TCONTAINER>
+auto TreeContainerBytes(const TCONTAINER &container) noexcept;
+
+/**
+ * @brief Get the heap bytes of a vector's buffer.
+ *
+ * @param vector The vector.
+ *
+ * @return The bytes.
+ */
+template <typename T>
+auto VectorBytes(const std::vector<T> &vector) noexcept;
+
+/**
+ * @brief Estimate the heap bytes owned by a value beyond its own size (zero unless the value is a
+ * string too long for the small-string buffer).
+ *
+ * @param value The value.
+ *
+ * @return The estimated bytes.
+ */
+template <typename T>
+auto OwnedBytes(const T &value) noexcept;
+
+/**
+ * @brief ObjectSizeTable struct, holding the recorded sizes of object types.
+ */
+struct ObjectSizeTable
+{
+    std::mutex m_mutex;                                        ///< The mutex for the sizes.
+    std::unordered_map<std::type_index, std::size_t> m_sizes;  ///< The sizes by type.
+
+    /**
+     * @brief Get the table shared by every registry.
+     *
+     * @return The table.
+     */
+    static ObjectSizeTable &Instance();
+};
+
+/**
+ * @brief Record the size of an object type, so that reports can account for objects known only
+ * through pointers to their base. Only the first call for each type does any work.
+ */
+template <typename T>
+void RecordObjectSize();
+
+/**
+ * @brief Get the recorded size of an object type.
+ *
+ * @param typeIndex The type index.
+ * @param fallbackSize The size to assume if none was recorded.
+ *
+ * @return The size in bytes.
+ */
+auto RecordedObjectSize(const std::type_index &typeIndex, const std::size_t fallbackSize);
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+inline MemoryReport &MemoryReport::operator+=(const MemoryReport &other) noexcept
+{
+    m_objectBytes += other.m_objectBytes;
+    m_indexBytes += other.m_indexBytes;
+    m_associationBytes += other.m_associationBytes;
+    m_edgeBytes += other.m_edgeBytes;
+    m_mutexBytes += other.m_mutexBytes;
+    return *this;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto MemoryReport::TotalBytes() const noexcept
+{
+    return m_objectBytes + m_indexBytes + m_associationBytes + m_edgeBytes + m_mutexBytes;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TCONTAINER>
+inline auto HashContainerBytes(const TCONTAINER &container) noexcept
+{
+    constexpr auto nodeBytes =
+        sizeof(typename TCONTAINER::value_type) + sizeof(void *) + sizeof(std::size_t);
+
+    return container.bucket_count() * sizeof(void *) + container.size() * nodeBytes;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TCONTAINER>
+inline auto TreeContainerBytes(const TCONTAINER &container) noexcept
+{
+    constexpr auto nodeBytes =
+        sizeof(typename TCONTAINER::value_type) + SIZE_T(4UL) * sizeof(void *);
+
+    return container.size() * nodeBytes;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline auto VectorBytes(const std::vector<T> &vector) noexcept
+{
+    return vector.capacity() * sizeof(T);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline auto OwnedBytes(const T &value) noexcept
+{
+    if constexpr (std::is_same<T, std::string>::value)
+    {
+        // Strings that fit the small-string buffer own no heap memory.
+        const auto smallStringCapacity = std::string{}.capacity();
+        return (value.capacity() > smallStringCapacity) ? value.capacity() + SIZE_T(1UL)
+                                                        : SIZE_T(0UL);
+    }
+
+    else
+    {
+        static_cast<void>(value);
+        return SIZE_T(0UL);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline ObjectSizeTable &ObjectSizeTable::Instance()
+{
+    static auto objectSizeTable = ObjectSizeTable{};
+    return objectSizeTable;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void RecordObjectSize()
+{
+    static const auto isRecorded = []() {
+        auto &objectSizeTable = ObjectSizeTable::Instance();
+        const auto lock = std::lock_guard<std::mutex>{objectSizeTable.m_mutex};
+        objectSizeTable.m_sizes.emplace(typeid(T), sizeof(T));
+        return true;
+    }();
+
+    static_cast<void>(isRecorded);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto RecordedObjectSize(const std::type_index &typeIndex, const std::size_t fallbackSize)
+{
+    auto &objectSizeTable = ObjectSizeTable::Instance();
+    const auto lock = std::lock_guard<std::mutex>{objectSizeTable.m_mutex};
+
+    const auto findIter = objectSizeTable.m_sizes.find(typeIndex);
+    return (findIter != objectSizeTable.m_sizes.cend()) ? findIter->second : fallbackSize;
+}
+}  // namespace kl
+
+#endif  // #ifndef KL_MEMORY_REPORT_H
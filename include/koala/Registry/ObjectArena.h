@@ -0,0 +1,420 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/include/koala/Registry/ObjectArena.h
+ *
+ * @brief Header file for the object arena (ObjectArena) class and its allocator (ArenaAllocator)
+ * and deleter (ArenaDeleter) class templates.
+ */
+
+#ifndef KL_OBJECT_ARENA_H
+#define KL_OBJECT_ARENA_H 1
+
+#include "koala/Definitions.h"
+
+#include <cstddef>
+#include <memory>
+
+namespace kl
+{
+/**
+ * @brief ObjectArena class. A thread-safe slab allocator that carves fixed-size blocks out of large
+ * chunks, recycles freed blocks through per-size free lists and releases all of its chunks in
+ * bulk once no block is live.
+ */
+class ObjectArena
+{
+public:
+    using sPtr = std::shared_ptr<ObjectArena>;  ///< Alias for a shared pointer to the arena.
+
+    /**
+     * @brief Constructor.
+     *
+     * @param chunkSize The size in bytes of each chunk.
+     */
+    explicit ObjectArena(const std::size_t chunkSize) noexcept;
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    ObjectArena(const ObjectArena &) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    ObjectArena(ObjectArena &&) = delete;
+
+    /**
+     * @brief Deleted copy assignment operator.
+     */
+    ObjectArena &operator=(const ObjectArena &) = delete;
+
+    /**
+     * @brief Deleted move assignment operator.
+     */
+    ObjectArena &operator=(ObjectArena &&) = delete;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~ObjectArena() = default;
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief Allocate a block, suitably aligned for any fundamental type.
+     *
+     * @param size The size of the block in bytes.
+     *
+     * @return Pointer to the block.
+     */
+    void *Allocate(const std::size_t size);
+
+    /**
+     * @brief Return a block to the arena.
+     *
+     * @param pBlock Pointer to the block.
+     * @param size The size with which the block was allocated.
+     */
+    void Deallocate(void *const pBlock, const std::size_t size) noexcept;
+
+    /**
+     * @brief Get the number of live blocks.
+     *
+     * @return The number of live blocks.
+     */
+    auto LiveBlockCount() const noexcept;
+
+    /**
+     * @brief Get the number of chunks currently held.
+     *
+     * @return The number of chunks currently held.
+     */
+    auto ChunkCount() const noexcept;
+
+private:
+    using Chunk = std::unique_ptr<std::byte[]>;  ///< Alias for a chunk of memory.
+    using FreeListMap = std::unordered_map<std::size_t,
+                                           std::vector<void *>>;  ///< Alias for free lists by size.
+
+    static constexpr auto ALIGNMENT = alignof(std::max_align_t);  ///< The block alignment.
+
+    /**
+     * @brief Round a size up to a multiple of the block alignment.
+     *
+     * @param size The size in bytes.
+     *
+     * @return The rounded size in bytes.
+     */
+    static constexpr auto RoundToAlignment(const std::size_t size) noexcept;
+
+    mutable Mutex m_mutex;  ///< A mutex for locking the arena during concurrent access.
+
+    std::size_t m_chunkSize;              ///< The size of each chunk in bytes.
+    std::vector<Chunk> m_chunks;          ///< The chunks held by the arena.
+    std::vector<Chunk> m_oversizeChunks;  ///< Chunks holding single blocks larger than a chunk.
+    std::size_t m_chunkOffset;  ///< The offset of the next free block in the last chunk.
+    FreeListMap m_freeListMap;  ///< The freed blocks available for reuse, by rounded size.
+    std::size_t m_nLiveBlocks;  ///< The number of live blocks.
+};
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief ArenaAllocator class template, a standard allocator drawing from an object arena.
+ */
+template <typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;  ///< Alias for the allocated type.
+
+    /**
+     * @brief Constructor.
+     *
+     * @param spArena Shared pointer to the arena.
+     */
+    explicit ArenaAllocator(ObjectArena::sPtr spArena) noexcept;
+
+    /**
+     * @brief Rebinding constructor.
+     *
+     * @param other The allocator to rebind.
+     */
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept;
+
+    /**
+     * @brief Allocate storage for a number of objects.
+     *
+     * @param n The number of objects.
+     *
+     * @return Pointer to the storage.
+     */
+    T *allocate(const std::size_t n);
+
+    /**
+     * @brief Deallocate storage for a number of objects.
+     *
+     * @param pStorage Pointer to the storage.
+     * @param n The number of objects.
+     */
+    void deallocate(T *const pStorage, const std::size_t n) noexcept;
+
+    /**
+     * @brief Get the arena.
+     *
+     * @return Shared pointer to the arena.
+     */
+    const auto &Arena() const noexcept;
+
+private:
+    ObjectArena::sPtr m_spArena;  ///< Shared pointer to the arena.
+};
+
+/**
+ * @brief Equality operator for arena allocators.
+ *
+ * @param lhs The first allocator.
+ * @param rhs The second allocator.
+ *
+ * @return Whether the allocators draw from the same arena.
+ */
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) noexcept;
+
+/**
+ * @brief Inequality operator for arena allocators.
+ *
+ * @param lhs The first allocator.
+ * @param rhs The second allocator.
+ *
+ * @return Whether the allocators draw from different arenas.
+ */
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) noexcept;
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+/**
+ * @brief ArenaDeleter class template, a shared pointer deleter for objects constructed in an
+ * object arena.
+ */
+template <typename TOBJECT>
+class ArenaDeleter
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param spArena Shared pointer to the arena.
+     */
+    explicit ArenaDeleter(ObjectArena::sPtr spArena) noexcept;
+
+    /**
+     * @brief Destroy an object and return its block to the arena.
+     *
+     * @param pObject Pointer to the object.
+     */
+    void operator()(TOBJECT *const pObject) const noexcept;
+
+private:
+    ObjectArena::sPtr m_spArena;  ///< Shared pointer to the arena.
+};
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+inline constexpr auto ObjectArena::RoundToAlignment(const std::size_t size) noexcept
+{
+    return (size + ALIGNMENT - SIZE_T(1UL)) / ALIGNMENT * ALIGNMENT;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline ObjectArena::ObjectArena(const std::size_t chunkSize) noexcept
+    : m_mutex{},
+      m_chunkSize{std::max(ALIGNMENT, RoundToAlignment(chunkSize))},
+      m_chunks{},
+      m_oversizeChunks{},
+      m_chunkOffset{SIZE_T(0UL)},
+      m_freeListMap{},
+      m_nLiveBlocks{SIZE_T(0UL)}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void *ObjectArena::Allocate(const std::size_t size)
+{
+    const auto roundedSize = RoundToAlignment(size);
+    const auto lock = WriteLock{m_mutex};
+
+    // Reuse a freed block of the same size if there is one.
+    auto &freeList = m_freeListMap[roundedSize];
+
+    if (!freeList.empty())
+    {
+        void *const pBlock = freeList.back();
+        freeList.pop_back();
+        ++m_nLiveBlocks;
+        return pBlock;
+    }
+
+    // Oversized blocks get a chunk of their own.
+    if (roundedSize > m_chunkSize)
+    {
+        m_oversizeChunks.emplace_back(new std::byte[roundedSize]);
+        ++m_nLiveBlocks;
+        return m_oversizeChunks.back().get();
+    }
+
+    // Array new provides storage aligned for any fundamental type.
+    if (m_chunks.empty() || m_chunkOffset + roundedSize > m_chunkSize)
+    {
+        m_chunks.emplace_back(new std::byte[m_chunkSize]);
+        m_chunkOffset = SIZE_T(0UL);
+    }
+
+    void *const pBlock = m_chunks.back().get() + m_chunkOffset;
+    m_chunkOffset += roundedSize;
+    ++m_nLiveBlocks;
+    return pBlock;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void ObjectArena::Deallocate(void *const pBlock, const std::size_t size) noexcept
+{
+    if (!pBlock) return;
+
+    const auto lock = WriteLock{m_mutex};
+
+    // Once nothing is live, release every chunk but the current one in bulk.
+    if (--m_nLiveBlocks == SIZE_T(0UL))
+    {
+        if (m_chunks.size() > SIZE_T(1UL))
+            m_chunks.erase(m_chunks.begin(), std::prev(m_chunks.end()));
+
+        m_oversizeChunks.clear();
+        m_freeListMap.clear();
+        m_chunkOffset = SIZE_T(0UL);
+        return;
+    }
+
+    try
+    {
+        m_freeListMap[RoundToAlignment(size)].push_back(pBlock);
+    }
+
+    catch (...)
+    {
+        // The block is leaked into its chunk until the arena empties.
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto ObjectArena::LiveBlockCount() const noexcept
+{
+    const auto lock = ReadLock{m_mutex};
+    return m_nLiveBlocks;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto ObjectArena::ChunkCount() const noexcept
+{
+    const auto lock = ReadLock{m_mutex};
+    return m_chunks.size() + m_oversizeChunks.size();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline ArenaAllocator<T>::ArenaAllocator(ObjectArena::sPtr spArena) noexcept
+    : m_spArena{std::move(spArena)}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+template <typename U>
+inline ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U> &other) noexcept
+    : m_spArena{other.Arena()}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline T *ArenaAllocator<T>::allocate(const std::size_t n)
+{
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "Cannot allocate over-aligned types from an object arena");
+
+    return static_cast<T *>(m_spArena->Allocate(n * sizeof(T)));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void ArenaAllocator<T>::deallocate(T *const pStorage, const std::size_t n) noexcept
+{
+    m_spArena->Deallocate(pStorage, n * sizeof(T));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline const auto &ArenaAllocator<T>::Arena() const noexcept
+{
+    return m_spArena;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, typename U>
+inline bool operator==(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) noexcept
+{
+    return (lhs.Arena() == rhs.Arena());
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, typename U>
+inline bool operator!=(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT>
+inline ArenaDeleter<TOBJECT>::ArenaDeleter(ObjectArena::sPtr spArena) noexcept
+    : m_spArena{std::move(spArena)}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TOBJECT>
+inline void ArenaDeleter<TOBJECT>::operator()(TOBJECT *const pObject) const noexcept
+{
+    pObject->~TOBJECT();
+    m_spArena->Deallocate(pObject, sizeof(TOBJECT));
+}
+}  // namespace kl
+
+#endif  // #ifndef KL_OBJECT_ARENA_H
@@ -16,6 +16,8 @@
 #ifndef KL_OBJECT_ASSOCIATION_H
 #define KL_OBJECT_ASSOCIATION_H 1
 
+#include "koala/Registry/AssociationTable.h"
+
 #ifdef KOALA_ENABLE_CEREAL
 #include "cereal/access.hpp"
 #include "cereal/types/polymorphic.hpp"
@@ -129,6 +131,19 @@ public:
      */
     virtual auto GetIndicatorString() const -> std::string = 0;
 
+#ifdef KOALA_ENABLE_CEREAL
+    /**
+     * @brief Restore the row for this association to an association table, as the table is not
+     * saved with the objects.
+     *
+     * @param associationTable The association table.
+     * @param sourceId The ID of the object holding this association.
+     * @param typeTag The tag of the associated object's type.
+     */
+    virtual void RestoreAssociation(AssociationTable &associationTable, const ID_t sourceId,
+                                    const TypeTag typeTag) const = 0;
+#endif  // #ifdef KOALA_ENABLE_CEREAL
+
 protected:
     using sPtr = std::shared_ptr<ObjectAssociationBase>;  ///< Alias for a shared pointer.
     using sPtrSet = std::unordered_set<sPtr>;  ///< Alias for an unordered set of shared pointers.
@@ -259,6 +274,19 @@ public:
      */
     auto GetIndicatorString() const -> std::string override;
 
+#ifdef KOALA_ENABLE_CEREAL
+    /**
+     * @brief Restore the row for this association to an association table, as the table is not
+     * saved with the objects.
+     *
+     * @param associationTable The association table.
+     * @param sourceId The ID of the object holding this association.
+     * @param typeTag The tag of the associated object's type.
+     */
+    void RestoreAssociation(AssociationTable &associationTable, const ID_t sourceId,
+                            const TypeTag typeTag) const override;
+#endif  // #ifdef KOALA_ENABLE_CEREAL
+
     /**
      * @brief Get the indicator flag.
      *
@@ -461,6 +489,23 @@ protected:
      */
     explicit AssociationInformation(const ObjectAssociationBase::sPtr &spAssociationBase);
 
+    /**
+     * @brief Constructor.
+     *
+     * @param id The ID of the associated object.
+     * @param isAlive Whether the associated object is alive.
+     * @param isCerealSerializable Whether the association is cereal-serializable.
+     * @param hasIndicator Whether the association has an indicator.
+     * @param identifierString The associated object's identifier string.
+     * @param typeName The name of the associated object's type.
+     * @param registryName The name of the associated object's registry.
+     * @param indicatorString The indicator string.
+     */
+    AssociationInformation(const kl::ID_t id, const bool isAlive, const bool isCerealSerializable,
+                           const bool hasIndicator, std::string identifierString,
+                           std::string typeName, std::string registryName,
+                           std::string indicatorString);
+
     template <typename TA, typename TB>
     friend class RegisteredObjectTemplate;
 
@@ -527,6 +572,23 @@ inline AssociationInformation::AssociationInformation(
 
 //--------------------------------------------------------------------------------------------------
 
+inline AssociationInformation::AssociationInformation(
+    const kl::ID_t id, const bool isAlive, const bool isCerealSerializable, const bool hasIndicator,
+    std::string identifierString, std::string typeName, std::string registryName,
+    std::string indicatorString)
+    : m_id{id},
+      m_isAlive{isAlive},
+      m_isCerealSerializable{isCerealSerializable},
+      m_hasIndicator{hasIndicator},
+      m_identifierString{std::move(identifierString)},
+      m_typeName{std::move(typeName)},
+      m_registryName{std::move(registryName)},
+      m_indicatorString{std::move(indicatorString)}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
 #ifdef KOALA_ENABLE_CEREAL
 inline AssociationInformation::AssociationInformation()
     : m_id{SIZE_T(0UL)},
@@ -185,6 +185,21 @@ inline auto ObjectAssociation<TOBJECT, TINDICATOR>::GetIndicatorStringImpl(std::
 
 //--------------------------------------------------------------------------------------------------
 
+#ifdef KOALA_ENABLE_CEREAL
+template <typename TOBJECT, typename TINDICATOR>
+inline void ObjectAssociation<TOBJECT, TINDICATOR>::RestoreAssociation(
+    AssociationTable &associationTable, const ID_t sourceId, const TypeTag typeTag) const
+{
+    if (m_hasIndicator)
+        associationTable.Associate(sourceId, this->ID(), typeTag, m_indicator);
+
+    else
+        associationTable.Associate(sourceId, this->ID(), typeTag);
+}
+#endif  // #ifdef KOALA_ENABLE_CEREAL
+
+//--------------------------------------------------------------------------------------------------
+
 #ifdef KOALA_ENABLE_CEREAL
 template <typename TOBJECT, typename TINDICATOR>
 template <typename TARCHIVE>
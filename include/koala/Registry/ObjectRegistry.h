@@ -15,6 +15,17 @@
 #define KL_OBJECT_REGISTRY_H 1
 
 #include "koala/Definitions.h"
+#include "koala/Registry/AliasIndex.h"
+#include "koala/Registry/AssociationTable.h"
+#include "koala/Registry/ChangeJournal.h"
+#include "koala/Registry/EpochDomain.h"
+#include "koala/Registry/Handle.h"
+#include "koala/Registry/MemoryReport.h"
+#include "koala/Registry/ObjectArena.h"
+#include "koala/Registry/PagedSlotVector.h"
+#include "koala/Registry/RegistrySnapshot.h"
+#include "koala/Registry/TypeTag.h"
+#include "koala/Registry/WorkerPool.h"
 
 #ifdef KOALA_ENABLE_CEREAL
 #include "cereal/access.hpp"
@@ -23,6 +34,13 @@
 #endif  // #ifdef KOALA_ENABLE_CEREAL
 
 #include <atomic>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <typeindex>
 
 namespace kl
 {
@@ -94,6 +112,13 @@ public:
      */
     virtual auto PrintableBaseName() const noexcept -> std::string = 0;
 
+    /**
+     * @brief Estimate the memory held by the registry and its objects.
+     *
+     * @return The memory report.
+     */
+    virtual auto MemoryUsage() const -> MemoryReport = 0;
+
 protected:
     using sPtr = std::shared_ptr<ObjectRegistryBase>;  ///< Alias for a shared pointer.
     using sPtrSet = std::unordered_set<sPtr>;  ///< Alias for an unordered set of shared pointers.
@@ -171,7 +196,10 @@ protected:
     friend class Koala;
     friend TBASE;  ///< The template type.
     friend class HierarchicalObjectTemplate<TBASE_D, TALIAS_D>;
-    friend class RegisteredObjectTemplate<TBASE_D, TALIAS_D>;
+    friend class RegistrySnapshot<TBASE, TALIAS>;
+
+    template <typename TA, typename TB>
+    friend class RegisteredObjectTemplate;  ///< Objects resolve their associations in any registry.
 
     template <typename T>
     friend class HierarchicalVisualizationUtility;
@@ -181,27 +209,211 @@ protected:
 #endif  // #ifdef KOALA_ENABLE_CEREAL
 
 private:
+    using AliasTraits = AliasIndexTraits<TALIAS_D>;  ///< Alias for the alias index traits.
+    using AliasKey = typename AliasTraits::Key;      ///< Alias for the alias index key type.
     using ObjectAliasToIdMap =
-        std::map<TALIAS_D, ID_t>;  ///< Alias for map from object aliases to IDs.
+        typename AliasTraits::Index;  ///< Alias for map from object alias keys to IDs.
     using ObjectIdToAliasMap =
         std::unordered_map<ID_t, TALIAS_D>;  ///< Alias for map from IDs to object aliases.
+    using ObjectIdToAliasNode =
+        typename ObjectIdToAliasMap::node_type;  ///< Alias for a node of the ID-to-alias map.
+
+    /**
+     * @brief Whether objects of a given type identify an object by its alias.
+     */
+    template <typename T>
+    using IsAliasKey = std::integral_constant<
+        bool, AliasTraits::template IsLookupKey<T>::value &&
+                  !std::is_base_of<TBASE_D, std::decay_t<T>>::value>;
     using ObjectIdMap =
         std::unordered_map<ID_t, TBASE_sPtr>;  ///< Alias for object ID to shared pointer map.
-    using ObjectTypeMultiMap =
-        std::unordered_multimap<std::string,
-                                TBASE_sPtr>;  ///< Alias for object types to shared pointer map.
+    using TBASE_sPtrVector =
+        std::vector<TBASE_sPtr>;  ///< Alias for a vector of shared pointers to decayed TBASE.
+    using ObjectTypeMap =
+        std::unordered_map<std::type_index,
+                           TBASE_sPtrVector>;  ///< Alias for object types to shared pointers map.
+    using ObjectTypeNameMap =
+        std::unordered_map<std::string,
+                           TBASE_sPtrVector>;  ///< Alias for type names to shared pointers map.
+
+    /**
+     * @brief ObjectSlot struct, holding an object, the tag of its concrete type and its position in
+     * the bucket for its type. A slot with a null object is a tombstone.
+     */
+    struct ObjectSlot
+    {
+        TBASE_sPtr m_spObject;                      ///< Shared pointer to the object.
+        TBASE_sPtrVector *m_pTypeBucket = nullptr;  ///< Pointer to the bucket for the object type.
+        std::size_t m_typePosition = 0UL;           ///< The position in the bucket for the type.
+        TypeTag m_typeTag = UNKNOWN_TYPE_TAG;       ///< The tag of the object type.
+
+        /**
+         * @brief Find out whether the slot holds an object.
+         *
+         * @return Whether the slot holds an object.
+         */
+        explicit operator bool() const noexcept;
+    };
+
+    using ObjectSlotVector =
+        PagedSlotVector<ObjectSlot>;  ///< Alias for a paged vector of object slots.
+
+    /**
+     * @brief Shard struct, holding one lock-striped partition of the registry maps. Objects live in
+     * the shard selected by their ID, in the slot given by their ID divided by the shard count, and
+     * alias-to-ID entries in the shard selected by the alias hash. The alias-to-ID keys refer to
+     * the aliases held by the ID-to-alias map, whose nodes are never copied while the key is
+     * indexed.
+     */
+    struct Shard
+    {
+        mutable kl::Mutex m_mutex;  ///< A mutex for locking this shard (only used when sharded).
+
+        ObjectSlotVector m_objectSlots;  ///< The object slots, indexed by ID / shard count.
+        ObjectTypeMap m_objectTypeMap;   ///< A map from the object types to the shared pointers.
+        ObjectAliasToIdMap m_objectAliasToIdMap;  ///< A map from the object aliases to IDs.
+        ObjectIdToAliasMap m_objectIdToAliasMap;  ///< A map from the IDs to the object aliases.
+    };
+
+    using ShardVector = std::vector<std::unique_ptr<Shard>>;  ///< Alias for a vector of shards.
+
+    using TBASE_pVector =
+        std::vector<TBASE_D *>;  ///< Alias for a vector of pointers to decayed TBASE.
+    using SnapshotTypeMap =
+        std::unordered_map<std::type_index,
+                           TBASE_pVector>;  ///< Alias for object types to pointers map.
+
+    /**
+     * @brief Snapshot struct, holding an immutable copy of the object slots, type buckets and alias
+     * maps, through which lookups go in read-mostly mode and registry snapshots are read. Its slots
+     * are indexed by ID and own the objects, and its alias-to-ID keys refer to the aliases held by
+     * its own ID-to-alias map.
+     */
+    struct Snapshot
+    {
+        std::size_t m_version = 0UL;              ///< The registry version captured.
+        ObjectSlotVector m_objectSlots;           ///< The object slots, indexed by ID.
+        SnapshotTypeMap m_objectTypeMap;          ///< A map from the object types to the objects.
+        ObjectAliasToIdMap m_objectAliasToIdMap;  ///< A map from the object aliases to IDs.
+        ObjectIdToAliasMap m_objectIdToAliasMap;  ///< A map from the IDs to the object aliases.
+    };
+
+    using Snapshot_cPtr =
+        std::shared_ptr<const Snapshot>;  ///< Alias for a shared pointer to a const snapshot.
+
+    /**
+     * @brief SnapshotGuard class, keeping the published snapshot alive for the duration of a
+     * lookup: through the reader epoch announced before reading its pointer or, for the lookup
+     * that has just published it, through a shared pointer.
+     */
+    class SnapshotGuard
+    {
+    public:
+        /**
+         * @brief Default constructor, guarding no snapshot.
+         */
+        SnapshotGuard() noexcept = default;
+
+        /**
+         * @brief Constructor, guarding a snapshot read within a reader epoch.
+         *
+         * @param pSnapshot Pointer to the snapshot.
+         * @param readGuard The guard of the reader epoch.
+         */
+        SnapshotGuard(const Snapshot *const pSnapshot, EpochDomain::ReadGuard &&readGuard) noexcept;
+
+        /**
+         * @brief Constructor, guarding a snapshot by sharing its ownership.
+         *
+         * @param spSnapshot Shared pointer to the snapshot.
+         */
+        explicit SnapshotGuard(Snapshot_cPtr spSnapshot) noexcept;
+
+        /**
+         * @brief Get the guarded snapshot.
+         *
+         * @return Pointer to the snapshot (null if none).
+         */
+        auto Get() const noexcept -> const Snapshot *;
+
+        /**
+         * @brief Access the guarded snapshot.
+         *
+         * @return Pointer to the snapshot.
+         */
+        auto operator->() const noexcept -> const Snapshot *;
+
+        /**
+         * @brief Find out whether a snapshot is guarded.
+         *
+         * @return Whether a snapshot is guarded.
+         */
+        explicit operator bool() const noexcept;
+
+    private:
+        const Snapshot *m_pSnapshot = nullptr;  ///< Pointer to the snapshot (null if none).
+        EpochDomain::ReadGuard m_readGuard;     ///< The guard of the reader epoch, if any.
+        Snapshot_cPtr m_spSnapshot;             ///< Shared pointer to the snapshot, if shared.
+    };
+
+    using ObjectArenaMap =
+        std::unordered_map<std::type_index,
+                           ObjectArena::sPtr>;  ///< Alias for map from object types to arenas.
+    using ShardWriteLocks =
+        std::pair<WriteLock, WriteLock>;  ///< Alias for a pair of shard write locks.
+
+    /**
+     * @brief ObjectChunk struct, describing a run of objects of one type in the copy taken by a
+     * parallel for-each, handed to one worker.
+     */
+    struct ObjectChunk
+    {
+        std::size_t m_begin;  ///< The position of the first object in the copy.
+        std::size_t m_end;    ///< The position past the last object in the copy.
+        TypeTag m_typeTag;    ///< The tag of the object type (unknown if derived).
+    };
+
+    static constexpr auto PARALLEL_CHUNK_SIZE = SIZE_T(1024UL);  ///< Objects per parallel chunk.
+
+    /**
+     * @brief PendingDeletions struct, holding deleted objects whose release has been deferred.
+     */
+    struct PendingDeletions
+    {
+        TBASE_sPtrVector m_objects;                     ///< The deleted objects.
+        std::vector<ObjectIdToAliasNode> m_aliasNodes;  ///< The ID-to-alias nodes of the objects.
+    };
 
     mutable kl::Mutex m_mutex;  ///< A mutex for locking this object during concurrent access.
 
     Koala_wPtr m_wpKoala;  ///< Weak pointer to the instance of Koala that owns this registry.
     std::string m_printableBaseName;      ///< A print-worthy name for the base-type object.
     mutable std::atomic<ID_t> m_idCount;  ///< A counter for assigning IDs to new objects.
-
-    ObjectIdMap m_objectIdMap;  ///< The map from the object IDs to shared pointers.
-    ObjectTypeMultiMap
-        m_objectTypeMultiMap;  ///< A map from the object types to the shared pointers.
-    ObjectAliasToIdMap m_objectAliasToIdMap;  ///< A map from the object aliases to IDs.
-    ObjectIdToAliasMap m_objectIdToAliasMap;  ///< A map from the IDs to the object aliases.
+    std::atomic<std::size_t> m_shardCount;  ///< The number of shards (one unless sharded).
+    float m_maxLoadFactor;  ///< The maximum load factor of the shards' hash maps.
+
+    ShardVector m_shards;  ///< The shards holding the object maps.
+    ObjectArenaMap m_objectArenaMap;  ///< The arenas in which objects of given types are created.
+    ChangeJournal::sPtr m_spChangeJournal;  ///< The journal of changes (null unless enabled).
+    AssociationTable m_associationTable;    ///< The compact associations formed by the objects.
+
+    std::atomic<bool> m_isDeferringDeletion;  ///< Whether deleted objects are released by Compact.
+    mutable kl::Mutex m_pendingMutex;         ///< A mutex for the pending deletions.
+    PendingDeletions m_pendingDeletions;      ///< The deleted objects awaiting release.
+
+    static constexpr auto MIN_STALE_LOOKUPS =
+        SIZE_T(64UL);  ///< The fewest locked lookups before a stale snapshot is rebuilt.
+    static constexpr auto STALE_LOOKUP_BATCH =
+        SIZE_T(16UL);  ///< The locked lookups each thread counts before adding them to the total.
+
+    std::atomic<bool> m_isReadMostly;    ///< Whether lookups go through snapshots.
+    std::atomic<std::size_t> m_version;  ///< The version of the contents (counted if read-mostly).
+    mutable kl::Mutex m_snapshotMutex;   ///< A mutex for publishing and retiring snapshots.
+    mutable Snapshot_cPtr m_spSnapshot;  ///< The published snapshot (owned under its mutex).
+    mutable std::atomic<const Snapshot *> m_pSnapshot;  ///< The published snapshot, for lookups.
+    mutable EpochDomain m_epochDomain;  ///< The epochs of the lookups reading the snapshot.
+    mutable std::atomic<std::size_t> m_snapshotSize;  ///< The objects in the last snapshot.
+    mutable std::atomic<std::size_t> m_nStaleLookups;  ///< The locked lookups since it went stale.
 
     /**
      * @brief Get the instance of Koala.
@@ -210,6 +422,384 @@ private:
      */
     auto &GetKoala() const;
 
+    /**
+     * @brief Find out whether the registry is in sharded mode.
+     *
+     * @return Whether the registry is in sharded mode.
+     */
+    auto IsSharded() const noexcept;
+
+    /**
+     * @brief Lock the registry mutex for modifying objects: exclusively when unsharded, or shared
+     * when sharded (in which case writers serialize on the shard mutexes instead).
+     *
+     * @return The pair of registry locks, only one of which holds the mutex.
+     */
+    auto LockForWriting() const;
+
+    /**
+     * @brief Get the shard holding the object with a given ID.
+     *
+     * @param objectId The object ID.
+     *
+     * @return The shard.
+     */
+    auto &GetShard(const ID_t objectId) const noexcept;
+
+    /**
+     * @brief Get the shard holding the alias-to-ID entry for a given alias.
+     *
+     * @param aliasKey The alias index key.
+     *
+     * @return The shard.
+     */
+    auto &GetAliasShard(const AliasKey &aliasKey) const noexcept;
+
+    /**
+     * @brief Get the index of the slot holding the object with a given ID, within its shard.
+     *
+     * @param objectId The object ID.
+     *
+     * @return The slot index.
+     */
+    auto SlotIndex(const ID_t objectId) const noexcept;
+
+    /**
+     * @brief Make a new, empty shard whose hash maps use the registry's maximum load factor.
+     *
+     * @return The new shard.
+     */
+    auto MakeShard() const;
+
+    /**
+     * @brief Apply the registry's maximum load factor to the hash maps of a shard.
+     *
+     * @param shard The shard.
+     */
+    void ApplyMaxLoadFactor(Shard &shard) const;
+
+    /**
+     * @brief Read-lock a shard (a no-op unless sharded).
+     *
+     * @param shard The shard.
+     *
+     * @return The shard lock.
+     */
+    auto ReadLockShard(const Shard &shard) const;
+
+    /**
+     * @brief Read-lock every shard at once, giving a consistent view across shards (a no-op unless
+     * sharded).
+     *
+     * @return The shard locks.
+     */
+    auto ReadLockShards() const;
+
+    /**
+     * @brief Estimate the bytes held by a pair of alias maps, including the aliases they own.
+     *
+     * @param objectAliasToIdMap The alias-to-ID map.
+     * @param objectIdToAliasMap The ID-to-alias map.
+     *
+     * @return The estimated bytes.
+     */
+    static auto AliasMapBytes(const ObjectAliasToIdMap &objectAliasToIdMap,
+                              const ObjectIdToAliasMap &objectIdToAliasMap) noexcept;
+
+    /**
+     * @brief Write-lock a shard (a no-op unless sharded).
+     *
+     * @param shard The shard.
+     *
+     * @return The shard lock.
+     */
+    auto WriteLockShard(const Shard &shard) const;
+
+    /**
+     * @brief Write-lock a pair of shards without risking deadlock (a no-op unless sharded).
+     *
+     * @param firstShard The first shard.
+     * @param secondShard The second shard, which may be the same as the first.
+     *
+     * @return The shard locks.
+     */
+    auto WriteLockShards(const Shard &firstShard, const Shard &secondShard) const;
+
+    /**
+     * @brief Count a change to the registry contents, so that readers take a new snapshot (a no-op
+     * unless read-mostly; note: requires the changed shard be locked).
+     */
+    void NotifyWrite() noexcept;
+
+    /**
+     * @brief Record a change in the change journal, if enabled (note: requires the changed shard be
+     * locked, so that the changes to each object are recorded in order).
+     *
+     * @param change The kind of change.
+     * @param objectId The ID of the changed object.
+     */
+    void RecordChange(const ChangeJournal::CHANGE change, const ID_t objectId) noexcept;
+
+    /**
+     * @brief Copy the current registry contents into a new snapshot (note: the registry mutex must
+     * be locked).
+     *
+     * @return The snapshot.
+     */
+    auto BuildSnapshot() const -> Snapshot_cPtr;
+
+    /**
+     * @brief Get the published snapshot if the registry is read-mostly and unchanged since (note:
+     * the snapshot mutex must be locked).
+     *
+     * @return The snapshot (null if there is none, or it is stale).
+     */
+    auto LoadCurrentSnapshot() const noexcept -> Snapshot_cPtr;
+
+    /**
+     * @brief Publish a snapshot for lookups, unless the registry has changed since it was copied,
+     * waiting for the lookups still reading the snapshot it replaces (note: the snapshot mutex
+     * must be locked).
+     *
+     * @param spSnapshot The snapshot.
+     *
+     * @return The snapshot it replaces, to be released once the registry is unlocked.
+     */
+    auto StoreSnapshot(const Snapshot_cPtr &spSnapshot) const noexcept -> Snapshot_cPtr;
+
+    /**
+     * @brief Withdraw the published snapshot and wait for the lookups still reading it, so that
+     * objects deleted from the registry are not kept alive by it.
+     *
+     * @return The snapshot, to be released once the registry is unlocked.
+     */
+    auto RetireSnapshot() const noexcept -> Snapshot_cPtr;
+
+    /**
+     * @brief Get a snapshot of the current registry contents, publishing a new one if the
+     * published one is stale.
+     *
+     * @return The snapshot.
+     */
+    auto PublishSnapshot() const -> Snapshot_cPtr;
+
+    /**
+     * @brief Acquire the published snapshot for the duration of a lookup. A current snapshot is
+     * read within a reader epoch, without touching any memory written by other lookups. A stale
+     * snapshot is not rebuilt by every lookup: lookups go through the locks until there have been
+     * as many as the last snapshot held objects, which pays for the copy, and one of them then
+     * rebuilds it while the others carry on.
+     *
+     * @return The guard of the snapshot (guarding none unless read-mostly and current).
+     */
+    auto AcquireSnapshot() const -> SnapshotGuard;
+
+    /**
+     * @brief Merge a given map from every shard into a single map.
+     *
+     * @param pMap Pointer to the shard map member.
+     *
+     * @return The merged map.
+     */
+    template <typename TMAP>
+    auto MergeShardMaps(TMAP Shard::*pMap) const;
+
+    /**
+     * @brief Merge the object slots from every shard into a single object ID map.
+     *
+     * @return The object ID map.
+     */
+    auto MergeShardSlots() const;
+
+    /**
+     * @brief Merge the type maps from every shard into a single map keyed by the type names.
+     *
+     * @return The merged type map.
+     */
+    auto MergeShardTypeMaps() const;
+
+    /**
+     * @brief Add an object to its slot and to the bucket for its type (note: does not lock the
+     * shard).
+     *
+     * @param shard The shard.
+     * @param typeIndex The object type.
+     * @param typeTag The tag of the object type.
+     * @param spObject Shared pointer to the object.
+     */
+    void AddToShard(Shard &shard, const std::type_index &typeIndex, const TypeTag typeTag,
+                    TBASE_sPtr spObject);
+
+    /**
+     * @brief Remove an object from the bucket for its type in constant time, by moving the last
+     * object in the bucket into its position (note: does not lock the shard).
+     *
+     * @param shard The shard.
+     * @param slot The slot of the object.
+     */
+    void RemoveFromTypeMap(Shard &shard, const ObjectSlot &slot) noexcept;
+
+    /**
+     * @brief Remove an object from its shard, leaving only its alias-to-ID entry, which may be held
+     * by another shard (note: does not lock the shard).
+     *
+     * @param shard The shard.
+     * @param objectId The ID of the object.
+     *
+     * @return Shared pointer to the removed object (null if not found) and its ID-to-alias node,
+     * which keeps the alias alive until its alias-to-ID entry is erased (empty if it had none).
+     */
+    auto ExtractFromShard(Shard &shard, const ID_t objectId) noexcept
+        -> std::pair<TBASE_sPtr, ObjectIdToAliasNode>;
+
+    /**
+     * @brief Erase the alias-to-ID entry of a removed object.
+     *
+     * @param objectAlias The alias of the object.
+     */
+    void EraseAliasToId(const TALIAS_D &objectAlias) noexcept;
+
+    /**
+     * @brief Take ownership of a deleted object and its ID-to-alias node until the next compaction,
+     * if deletion is deferred; otherwise they are released by the caller as usual. Either way, the
+     * object must already have been removed from every map.
+     *
+     * @param spObject The deleted object.
+     * @param aliasNode The ID-to-alias node of the object (may be empty).
+     */
+    void DeferRelease(TBASE_sPtr &spObject, ObjectIdToAliasNode &aliasNode) noexcept;
+
+    /**
+     * @brief Add an alias for an object to the shard maps, interning it in the ID-to-alias map
+     * (note: does not lock the shards).
+     *
+     * @param shard The shard holding the object.
+     * @param objectId The ID of the object.
+     * @param objectAlias The alias of the object.
+     *
+     * @return Whether the alias was added (false if the alias already exists).
+     */
+    auto InsertAlias(Shard &shard, const ID_t objectId, TALIAS_D &&objectAlias);
+
+    /**
+     * @brief Reserve space in every shard for a number of new objects of a given type (note: does
+     * not lock the shards).
+     *
+     * @param typeIndex The object type.
+     * @param nNewObjects The number of new objects.
+     */
+    void ReserveShards(const std::type_index &typeIndex, const std::size_t nNewObjects);
+
+    /**
+     * @brief Create a number of objects under one lock, with a contiguous block of IDs. All the
+     * objects are made before any is registered, and registering them is rolled back on failure.
+     *
+     * @param count The number of objects to create.
+     * @param makeObject Callable taking the index and ID of the object to create and returning a
+     * shared pointer to the new object.
+     *
+     * @return References to the new objects, in ID order.
+     */
+    template <typename TOBJECT, typename TMAKEOBJECT>
+    auto CreateManyImpl(const std::size_t count, TMAKEOBJECT &&makeObject);
+
+    /**
+     * @brief Construct a new object, in the arena for its type if there is one (note: requires the
+     * registry mutex be held).
+     *
+     * @param objectId The ID of the object.
+     * @param parameters The parameters with which to instantiate the object.
+     *
+     * @return Shared pointer to the new object.
+     */
+    template <typename TOBJECT, typename... TPARAMETERS>
+    auto MakeObject(const ID_t objectId, TPARAMETERS &&... parameters);
+
+    /**
+     * @brief Add a new object to its shard's slots and type map (note: does not lock the shard).
+     *
+     * @param shard The shard.
+     * @param spObject Shared pointer to the object.
+     */
+    template <typename TOBJECT>
+    void AddToShard(Shard &shard, const TBASE_sPtr &spObject);
+
+    /**
+     * @brief Find the slot holding the object with a given ID.
+     *
+     * @param pSnapshot Pointer to the snapshot in which to look (null to look in the shards).
+     * @param objectId The ID of the object.
+     *
+     * @return A copy of the slot (a tombstone if not found).
+     */
+    auto FindSlot(const Snapshot *const pSnapshot, const ID_t objectId) const -> ObjectSlot;
+
+    /**
+     * @brief Cast an object to a given type, comparing type tags and only resorting to a dynamic
+     * cast when the object is not of exactly that type.
+     *
+     * @param spObject Shared pointer to the object.
+     * @param typeTag The tag of the object type.
+     *
+     * @return Shared pointer to the cast object (null if it is not of the given type).
+     */
+    template <typename TOBJECT>
+    static auto CastObject(const TBASE_sPtr &spObject, const TypeTag typeTag) noexcept
+        -> std::shared_ptr<std::decay_t<TOBJECT>>;
+
+    /**
+     * @brief Cast a raw pointer to an object to a given type, as for CastObject but without
+     * touching the reference count.
+     *
+     * @param pObject Pointer to the object.
+     * @param typeTag The tag of the object type.
+     *
+     * @return Pointer to the cast object (null if it is not of the given type).
+     */
+    template <typename TOBJECT>
+    static auto CastObjectPointer(TBASE_D *const pObject, const TypeTag typeTag) noexcept
+        -> std::decay_t<TOBJECT> *;
+
+    /**
+     * @brief Call a function on every type bucket, in every shard, holding objects of a given kind
+     * (i.e. of the type or of one of its subclasses). Empty buckets are skipped.
+     *
+     * @param function The function, taking the type and the bucket.
+     */
+    template <typename TOBJECT, typename TFUNCTION>
+    void ForEachBucketOfKind(TFUNCTION &&function) const;
+
+    /**
+     * @brief Collect the objects castable to a given type from every shard, bucket by bucket.
+     *
+     * @return Shared pointers to the objects.
+     */
+    template <typename TOBJECT>
+    auto CollectObjects() const;
+
+    /**
+     * @brief Collect the objects castable to a given type whose IDs lie in a given range, in ID
+     * order.
+     *
+     * @param firstId The first ID in the range.
+     * @param lastId The last ID in the range.
+     *
+     * @return Shared pointers to the objects.
+     */
+    template <typename TOBJECT>
+    auto CollectObjectsInRange(const ID_t firstId, const ID_t lastId) const;
+
+    /**
+     * @brief Find the ID of the object with a given alias.
+     *
+     * @param pSnapshot Pointer to the snapshot in which to look (null to look in the shards).
+     * @param aliasKey The alias index key.
+     *
+     * @return The object ID (empty if not found).
+     */
+    auto FindIdByAlias(const Snapshot *const pSnapshot, const AliasKey &aliasKey) const
+        -> std::optional<ID_t>;
+
     /**
      * @brief Add an already-created object to the registry while it is being constructed.
      *
@@ -253,7 +843,7 @@ private:
      * @return Shared pointer to the object.
      */
     template <typename T,
-              typename = std::enable_if_t<std::is_same<TALIAS_D, std::decay_t<T>>::value ||
+              typename = std::enable_if_t<IsAliasKey<T>::value ||
                                           std::is_base_of<TBASE_D, std::decay_t<T>>::value>>
     auto GetSharedPointer(T &&arg) const;
 
@@ -266,6 +856,47 @@ private:
      */
     auto GetSharedPointer(const ID_t objectId) const;
 
+    /**
+     * @brief Get the shared pointer to the object with a given handle.
+     *
+     * @param handle The handle of the object to get.
+     *
+     * @return Shared pointer to the object.
+     */
+    template <typename TOBJECT>
+    auto GetSharedPointer(const Handle<TOBJECT> &handle) const;
+
+    /**
+     * @brief Find the shared pointer to the object with a given ID, cast to a given type.
+     *
+     * @param objectId The ID of the object.
+     *
+     * @return Shared pointer to the object (null if it does not exist or is not of the type).
+     */
+    template <typename TOBJECT>
+    auto FindSharedPointer(const ID_t objectId) const -> std::shared_ptr<std::decay_t<TOBJECT>>;
+
+    /**
+     * @brief Tag dispatcher for getting the slot of an object by object or by alias.
+     *
+     * @param pSnapshot Pointer to the snapshot in which to look (null to look in the shards).
+     * @param arg The object or the alias of the object.
+     *
+     * @return A copy of the slot.
+     */
+    template <typename T>
+    auto GetSlot(const Snapshot *const pSnapshot, T &&arg) const;
+
+    /**
+     * @brief Get the slot of the object with a given ID.
+     *
+     * @param pSnapshot Pointer to the snapshot in which to look (null to look in the shards).
+     * @param objectId The ID of the object.
+     *
+     * @return A copy of the slot.
+     */
+    auto GetSlot(const Snapshot *const pSnapshot, const ID_t objectId) const;
+
     /**
      * @brief Delete the given shared pointer.
      *
@@ -275,74 +906,96 @@ private:
      */
     auto DeleteSharedPointer(TBASE_sPtr &&spObject) noexcept;
 
+    /**
+     * @brief Delete the object with a given ID (note: does not lock the registry mutex).
+     *
+     * @param objectId The ID of the object to delete.
+     * @param spRemovedObject Receives the removed object (unless its release is deferred), so that
+     * the caller can release it once the registry is unlocked.
+     *
+     * @return Success.
+     */
+    auto DeleteImpl(const ID_t objectId, TBASE_sPtr &spRemovedObject) noexcept;
+
     /**
      * @brief Delete the object with a given name.
      *
      * @param objectAlias The alias of the object to delete.
+     * @param spRemovedObject Receives the removed object (unless its release is deferred).
      *
      * @return Success.
      */
     template <typename TTHISALIAS>
-    auto DeleteImpl(TTHISALIAS &&objectAlias, std::true_type) noexcept;
+    auto DeleteImpl(TTHISALIAS &&objectAlias, TBASE_sPtr &spRemovedObject,
+                    std::true_type) noexcept;
 
     /**
      * @brief Delete the object given the object itself.
      *
      * @param object The object to delete.
+     * @param spRemovedObject Receives the removed object (unless its release is deferred).
      *
      * @return Success.
      */
     template <typename TOBJECT = TBASE_D>
-    auto DeleteImpl(TOBJECT &&object, std::false_type) noexcept;
+    auto DeleteImpl(TOBJECT &&object, TBASE_sPtr &spRemovedObject, std::false_type) noexcept;
 
     /**
-     * @brief Get the shared pointer to the object from a copy of the object.
+     * @brief Get the slot of the object from a copy of the object.
      *
+     * @param pSnapshot Pointer to the snapshot in which to look (null to look in the shards).
      * @param object The copy of the object.
      *
-     * @return Shared pointer to the object.
+     * @return A copy of the slot.
      */
     template <typename TOBJECT = TBASE_D>
-    auto GetSharedPointerImpl(TOBJECT &&object, std::false_type) const;
+    auto GetSlotImpl(const Snapshot *const pSnapshot, TOBJECT &&object, std::false_type) const;
 
     /**
-     * @brief Get the shared pointer to the object with a given alias.
+     * @brief Get the slot of the object with a given alias.
      *
+     * @param pSnapshot Pointer to the snapshot in which to look (null to look in the shards).
      * @param objectAlias The alias of the object to get.
      *
-     * @return Shared pointer to the object.
+     * @return A copy of the slot.
      */
     template <typename TTHISALIAS>
-    auto GetSharedPointerImpl(TTHISALIAS &&objectAlias, std::true_type) const;
+    auto GetSlotImpl(const Snapshot *const pSnapshot, TTHISALIAS &&objectAlias,
+                     std::true_type) const;
 
     /**
      * @brief Find out whether an object exists in the registry from a copy of the object.
      *
+     * @param pSnapshot Pointer to the snapshot in which to look (null to look in the shards).
      * @param object The copy of the object.
      *
      * @return Whether the object exists in the registry.
      */
     template <typename TDESIRED, typename TOBJECT = TBASE_D>
-    auto DoesObjectExistImpl(TOBJECT &&object, std::false_type) const noexcept;
+    auto DoesObjectExistImpl(const Snapshot *const pSnapshot, TOBJECT &&object,
+                             std::false_type) const noexcept;
 
     /**
      * @brief Find out whether an object exists in the registry with a given alias.
      *
+     * @param pSnapshot Pointer to the snapshot in which to look (null to look in the shards).
      * @param objectAlias The alias of the object.
      *
      * @return Whether the object exists in the registry.
      */
     template <typename TDESIRED, typename TTHISALIAS>
-    auto DoesObjectExistImpl(TTHISALIAS &&objectAlias, std::true_type) const noexcept;
+    auto DoesObjectExistImpl(const Snapshot *const pSnapshot, TTHISALIAS &&objectAlias,
+                             std::true_type) const noexcept;
 
     /**
      * @brief Find out whether an object has an alias (implementation).
      *
+     * @param pSnapshot Pointer to the snapshot in which to look (null to look in the shards).
      * @param objectId The object's ID.
      *
      * @return Whether the object has an alias.
      */
-    auto HasAliasImpl(const ID_t objectId) const noexcept;
+    auto HasAliasImpl(const Snapshot *const pSnapshot, const ID_t objectId) const noexcept;
 
     /**
      * @brief Add an alias to an object (implementation).
@@ -413,6 +1066,137 @@ public:
      */
     auto PrintableBaseName() const noexcept -> std::string override;
 
+    /**
+     * @brief Get the number of lock-striped shards.
+     *
+     * @return The number of shards.
+     */
+    auto ShardCount() const noexcept;
+
+    /**
+     * @brief Set the number of lock-striped shards, redistributing any existing objects. With more
+     * than one shard, concurrent creation, retrieval and deletion of objects in different shards
+     * no longer serialize on the registry mutex.
+     *
+     * @param shardCount The number of shards.
+     */
+    void ShardCount(const std::size_t shardCount);
+
+    /**
+     * @brief Find out whether the registry is in read-mostly mode.
+     *
+     * @return Whether the registry is in read-mostly mode.
+     */
+    auto ReadMostly() const noexcept;
+
+    /**
+     * @brief Set whether the registry is in read-mostly mode. In read-mostly mode, lookups by ID or
+     * alias, alias queries and CountAll go through an immutable snapshot published by the registry,
+     * without touching the registry locks or the snapshot's reference count. A change to the
+     * registry makes the snapshot stale, and lookups go through the locks until enough of them have
+     * been made to pay for a new one. Deleting objects withdraws the snapshot, so they are released
+     * once the lookups still using it return.
+     *
+     * @param isReadMostly Whether the registry is in read-mostly mode.
+     */
+    void ReadMostly(const bool isReadMostly);
+
+    /**
+     * @brief Pre-size the registry for a number of new objects of a given type, so that bulk
+     * loading does not repeatedly grow the slot tables, the type bucket and (if the objects are to
+     * be given aliases) the alias maps. Resharding afterwards discards the reservation.
+     *
+     * @param nObjects The number of new objects.
+     * @param nAliases The number of new aliases.
+     */
+    template <typename TOBJECT = TBASE_D>
+    void Reserve(const std::size_t nObjects, const std::size_t nAliases = SIZE_T(0UL));
+
+    /**
+     * @brief Get the maximum load factor of the registry's hash maps.
+     *
+     * @return The maximum load factor.
+     */
+    auto MaxLoadFactor() const;
+
+    /**
+     * @brief Set the maximum load factor of the registry's hash maps, rehashing them if need be. A
+     * higher load factor trades lookup speed for memory.
+     *
+     * @param maxLoadFactor The maximum load factor.
+     */
+    void MaxLoadFactor(const float maxLoadFactor);
+
+    /**
+     * @brief Find out whether deletion is deferred.
+     *
+     * @return Whether deletion is deferred.
+     */
+    auto DeferDeletion() const noexcept;
+
+    /**
+     * @brief Set whether deletion is deferred. Deferred deletions hide objects from every lookup
+     * immediately, but hold on to them until Compact is called, so that their destructors run
+     * outside the registry locks (and, if Compact is called from a background thread, off the
+     * deleting thread). Turning deferral off compacts the registry.
+     *
+     * @param isDeferringDeletion Whether deletion is deferred.
+     */
+    void DeferDeletion(const bool isDeferringDeletion);
+
+    /**
+     * @brief Release the objects whose deletion was deferred, running their destructors without
+     * holding any registry lock.
+     *
+     * @return The number of objects released.
+     */
+    auto Compact();
+
+    /**
+     * @brief Get the number of deleted objects awaiting release by Compact.
+     *
+     * @return The number of objects.
+     */
+    auto PendingDeletionCount() const;
+
+    /**
+     * @brief Create all subsequent objects of a given type in an arena, which holds each object
+     * and its shared pointer control block in the same slab and releases its memory in bulk once
+     * every object in it is deleted.
+     *
+     * @param chunkSize The size in bytes of each slab in the arena.
+     */
+    template <typename TOBJECT = TBASE_D>
+    void EnableArena(const std::size_t chunkSize = SIZE_T(1UL) << SIZE_T(16UL));
+
+    /**
+     * @brief Create all subsequent objects of a given type on the heap (existing objects keep their
+     * arena alive).
+     */
+    template <typename TOBJECT = TBASE_D>
+    void DisableArena();
+
+    /**
+     * @brief Record every subsequent creation, deletion and alias addition in a bounded change
+     * journal, from which consumers can pick up the changes since they last looked instead of
+     * rescanning the registry. Replaces any existing journal.
+     *
+     * @param capacity The number of changes kept before the oldest are overwritten.
+     */
+    void EnableChangeJournal(const std::size_t capacity = SIZE_T(1UL) << SIZE_T(16UL));
+
+    /**
+     * @brief Stop recording changes (consumers holding the journal can still read it).
+     */
+    void DisableChangeJournal();
+
+    /**
+     * @brief Get the change journal, which consumers read without locking the registry.
+     *
+     * @return Shared pointer to the change journal (null unless enabled).
+     */
+    auto GetChangeJournal() const;
+
     /**
      * @brief Create an object.
      *
@@ -435,15 +1219,41 @@ public:
     auto &CreateByAlias(TTHISALIAS &&objectAlias, TPARAMETERS &&... parameters);
 
     /**
-     * @brief Get the object with a given alias.
+     * @brief Create a number of objects with the same parameters, under one lock and with a
+     * contiguous block of IDs. If any of them fails to be created, none is registered.
+     *
+     * @param count The number of objects to create.
+     * @param parameters The parameters with which to instantiate each object.
+     *
+     * @return References to the new objects, in ID order.
+     */
+    template <typename TOBJECT = TBASE_D, typename... TPARAMETERS>
+    auto CreateMany(const std::size_t count, const TPARAMETERS &... parameters);
+
+    /**
+     * @brief Create a number of objects with parameters given by a generator, under one lock and
+     * with a contiguous block of IDs. If the generator or a constructor throws, none of the objects
+     * is registered.
+     *
+     * @param count The number of objects to create.
+     * @param generator The generator, taking the index of the object to create and returning a
+     * tuple of the parameters with which to instantiate it.
+     *
+     * @return References to the new objects, in ID order.
+     */
+    template <typename TOBJECT = TBASE_D, typename TGENERATOR>
+    auto CreateManyFrom(const std::size_t count, TGENERATOR &&generator);
+
+    /**
+     * @brief Get the object with a given alias, which may be given as any type from which the alias
+     * index can look it up (e.g. a string view or C string for string aliases).
      *
      * @param objectAlias The alias of the object to get.
      *
      * @return The retrieved object.
      */
     template <typename TOBJECT = TBASE_D, typename TTHISALIAS,
-              typename = std::enable_if_t<
-                  std::is_same<std::decay_t<TALIAS>, std::decay_t<TTHISALIAS>>::value>>
+              typename = std::enable_if_t<IsAliasKey<TTHISALIAS>::value>>
     auto &Get(TTHISALIAS &&objectAlias) const;
 
     /**
@@ -468,7 +1278,49 @@ public:
     auto &Get(const ID_t objectId) const;
 
     /**
-     * @brief Get all the objects of a given type by value.
+     * @brief Get the object with a given handle.
+     *
+     * @param handle The handle of the object to get.
+     *
+     * @return The retrieved object.
+     */
+    template <typename TOBJECT>
+    auto &Get(const Handle<TOBJECT> &handle) const;
+
+    /**
+     * @brief Validate a handle and dereference it, without touching the object's reference count.
+     *
+     * @param handle The handle of the object.
+     *
+     * @return Pointer to the object (null if it has been deleted or the handle is null).
+     */
+    template <typename TOBJECT>
+    auto Resolve(const Handle<TOBJECT> &handle) const -> std::decay_t<TOBJECT> *;
+
+    /**
+     * @brief Get a handle to an object.
+     *
+     * @param object The object.
+     *
+     * @return The handle.
+     */
+    template <typename TOBJECT,
+              typename = std::enable_if_t<std::is_base_of<TBASE_D, std::decay_t<TOBJECT>>::value>>
+    auto GetHandle(TOBJECT &&object) const noexcept;
+
+    /**
+     * @brief Get a handle to the object with a given ID, checking that it exists and is of the
+     * given type.
+     *
+     * @param objectId The ID of the object.
+     *
+     * @return The handle.
+     */
+    template <typename TOBJECT = TBASE_D>
+    auto GetHandle(const ID_t objectId) const;
+
+    /**
+     * @brief Get all the objects of a given type, including those of its subclasses, by value.
      *
      * @return The list of retrieved objects.
      */
@@ -484,7 +1336,57 @@ public:
     auto GetAll() const;
 
     /**
-     * @brief Get the number of objects of a given type.
+     * @brief Get the range-based container for getting the objects of a given type whose IDs lie
+     * in a given range, in ID order. IDs are assigned in increasing order, so this is also the
+     * order of creation, and GetRange(objectId + 1) gets the objects created after a given object.
+     * The cost grows with the number of IDs in the range, not with the size of the registry.
+     *
+     * @param firstId The first ID in the range.
+     * @param lastId The last ID in the range (by default, the largest ID).
+     *
+     * @return The range-based container for getting the objects.
+     */
+    template <typename TOBJECT = TBASE_D>
+    auto GetRange(const ID_t firstId, const ID_t lastId = std::numeric_limits<ID_t>::max()) const;
+
+    /**
+     * @brief Get the range-based container for getting all objects of a given type, in ID (and so
+     * creation) order.
+     *
+     * @return The range-based container for getting all objects.
+     */
+    template <typename TOBJECT = TBASE_D>
+    auto GetAllOrdered() const;
+
+    /**
+     * @brief Call a function on every object of a given type, splitting the objects into chunks
+     * that a number of threads claim in turn. The objects present at the call are copied (as
+     * shared pointers) under a read lock that is released before the function is first called, so
+     * the function may use and modify the registry; objects it deletes are still visited, and
+     * objects it creates are not. The threads come from a process-wide pool kept between calls. If
+     * the function throws, the remaining chunks are abandoned and the first exception is rethrown.
+     *
+     * @param function The function, taking a reference to the object (called concurrently).
+     * @param nThreads The number of threads, including the calling thread (zero for one per core).
+     *
+     * @return The number of objects visited.
+     */
+    template <typename TOBJECT = TBASE_D, typename TFUNCTION>
+    auto ParallelForEach(TFUNCTION &&function, const std::size_t nThreads = SIZE_T(0UL)) const;
+
+    /**
+     * @brief Take an immutable snapshot of the registry contents, which long-running readers can
+     * iterate over without holding any lock, so that writers are never blocked by them. Taking it
+     * copies the object pointers, not the objects; in read-mostly mode, snapshots taken with no
+     * write in between are shared.
+     *
+     * @return The snapshot.
+     */
+    auto TakeSnapshot() const;
+
+    /**
+     * @brief Get the number of objects of a given type, including those of its subclasses. This
+     * sums the sizes of the per-type buckets, so its cost does not grow with the number of objects.
      *
      * @return The number of objects of a given type.
      */
@@ -498,6 +1400,15 @@ public:
      */
     auto CountAll() const noexcept;
 
+    /**
+     * @brief Estimate the memory held by the registry and its objects, by category. Objects are
+     * sized by their concrete type when created through the registry; objects created in arenas
+     * are counted as if allocated individually.
+     *
+     * @return The memory report.
+     */
+    auto MemoryUsage() const -> MemoryReport override;
+
     /**
      * @brief Tag dispatcher for deleting objects by object or by alias.
      *
@@ -506,7 +1417,7 @@ public:
      * @return Success.
      */
     template <typename T,
-              typename = std::enable_if_t<std::is_same<TALIAS_D, std::decay_t<T>>::value ||
+              typename = std::enable_if_t<IsAliasKey<T>::value ||
                                           std::is_base_of<TBASE_D, std::decay_t<T>>::value>>
     auto Delete(T &&arg) noexcept;
 
@@ -519,6 +1430,36 @@ public:
      */
     auto Delete(const ID_t objectId) noexcept;
 
+    /**
+     * @brief Delete the object with a given handle.
+     *
+     * @param handle The handle of the object to delete.
+     *
+     * @return Success (false if it had already been deleted).
+     */
+    template <typename TOBJECT>
+    auto Delete(const Handle<TOBJECT> &handle) noexcept;
+
+    /**
+     * @brief Delete all the objects satisfying a predicate, in a single pass under one lock.
+     *
+     * @param predicate The predicate, taking a const reference to the object.
+     *
+     * @return The number of objects deleted.
+     */
+    template <typename TPREDICATE>
+    auto DeleteIf(TPREDICATE &&predicate);
+
+    /**
+     * @brief Delete the objects with the given IDs, under one lock.
+     *
+     * @param objectIds The IDs of the objects to delete (unknown IDs are skipped).
+     *
+     * @return The number of objects deleted.
+     */
+    template <typename TIDS>
+    auto DeleteMany(const TIDS &objectIds) noexcept;
+
     /**
      * @brief Delete all the objects in the registry.
      */
@@ -591,7 +1532,7 @@ public:
      * @return Whether the object exists in the registry.
      */
     template <typename TDESIRED, typename T,
-              typename = std::enable_if_t<std::is_same<TALIAS_D, std::decay_t<T>>::value ||
+              typename = std::enable_if_t<IsAliasKey<T>::value ||
                                           std::is_base_of<TBASE_D, std::decay_t<T>>::value>>
     auto DoesObjectExist(T &&arg) const noexcept;
 
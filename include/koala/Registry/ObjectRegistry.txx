@@ -39,10 +39,23 @@ ObjectRegistry<TBASE, TALIAS>::ObjectRegistry(Koala_wPtr wpKoala,
       m_wpKoala{std::move_if_noexcept(wpKoala)},
       m_printableBaseName{std::move_if_noexcept(printableBaseName)},
       m_idCount{SIZE_T(0UL)},
-      m_objectIdMap{},
-      m_objectTypeMultiMap{},
-      m_objectAliasToIdMap{},
-      m_objectIdToAliasMap{}
+      m_shardCount{SIZE_T(1UL)},
+      m_maxLoadFactor{1.0F},
+      m_shards{},
+      m_objectArenaMap{},
+      m_spChangeJournal{},
+      m_associationTable{},
+      m_isDeferringDeletion{false},
+      m_pendingMutex{},
+      m_pendingDeletions{},
+      m_isReadMostly{false},
+      m_version{SIZE_T(0UL)},
+      m_snapshotMutex{},
+      m_spSnapshot{},
+      m_pSnapshot{nullptr},
+      m_epochDomain{},
+      m_snapshotSize{SIZE_T(0UL)},
+      m_nStaleLookups{SIZE_T(0UL)}
 {
     static_assert(
         !std::is_same<TBASE_D, ID_t>::value,
@@ -56,6 +69,8 @@ ObjectRegistry<TBASE, TALIAS>::ObjectRegistry(Koala_wPtr wpKoala,
     static_assert(
         !std::is_base_of<TBASE_D, TALIAS_D>::value,
         "Cannot instantiate an object registry if the base type is a base of the alias type");
+
+    m_shards.emplace_back(this->MakeShard());
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -74,7 +89,872 @@ auto &ObjectRegistry<TBASE, TALIAS>::GetKoala() const
 {
     if (const auto spKoala = m_wpKoala.lock()) return *spKoala;
 
-    KL_THROW("Failed to get instance of Koala");
+    KL_THROW("Failed to get instance of Koala");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::IsSharded() const noexcept
+{
+    return (m_shardCount.load() > SIZE_T(1UL));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::LockForWriting() const
+{
+    // The mode can only change under an exclusive lock, so it is stable once either lock is held.
+    while (true)
+    {
+        const auto isSharded = this->IsSharded();
+        auto locks = isSharded ? std::make_pair(WriteLock{}, ReadLock{m_mutex})
+                               : std::make_pair(WriteLock{m_mutex}, ReadLock{});
+
+        if (isSharded == this->IsSharded()) return locks;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto &ObjectRegistry<TBASE, TALIAS>::GetShard(const ID_t objectId) const noexcept
+{
+    return *m_shards[objectId % m_shards.size()];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto &ObjectRegistry<TBASE, TALIAS>::GetAliasShard(const AliasKey &aliasKey) const noexcept
+{
+    if (m_shards.size() == SIZE_T(1UL)) return *m_shards.front();
+
+    return *m_shards[std::hash<AliasKey>{}(aliasKey) % m_shards.size()];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::SlotIndex(const ID_t objectId) const noexcept
+{
+    return objectId / m_shards.size();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::MakeShard() const
+{
+    auto upShard = std::make_unique<Shard>();
+    this->ApplyMaxLoadFactor(*upShard);
+
+    return upShard;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline void ObjectRegistry<TBASE, TALIAS>::ApplyMaxLoadFactor(Shard &shard) const
+{
+    shard.m_objectTypeMap.max_load_factor(m_maxLoadFactor);
+    shard.m_objectIdToAliasMap.max_load_factor(m_maxLoadFactor);
+#ifndef KOALA_ORDERED_ALIAS_INDEX
+    shard.m_objectAliasToIdMap.max_load_factor(m_maxLoadFactor);
+#endif  // #ifndef KOALA_ORDERED_ALIAS_INDEX
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::ReadLockShard(const Shard &shard) const
+{
+    return this->IsSharded() ? ReadLock{shard.m_mutex} : ReadLock{};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::ReadLockShards() const
+{
+    auto locks = std::vector<ReadLock>{};
+    if (!this->IsSharded()) return locks;
+
+    // Writers lock at most two shards without holding one while waiting for the other.
+    locks.reserve(m_shards.size());
+    for (const auto &spShard : m_shards) locks.emplace_back(spShard->m_mutex);
+
+    return locks;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::AliasMapBytes(
+    const ObjectAliasToIdMap &objectAliasToIdMap,
+    const ObjectIdToAliasMap &objectIdToAliasMap) noexcept
+{
+#ifdef KOALA_ORDERED_ALIAS_INDEX
+    auto bytes = TreeContainerBytes(objectAliasToIdMap) + HashContainerBytes(objectIdToAliasMap);
+#else
+    auto bytes = HashContainerBytes(objectAliasToIdMap) + HashContainerBytes(objectIdToAliasMap);
+#endif  // #ifdef KOALA_ORDERED_ALIAS_INDEX
+
+    // The alias-to-ID keys refer to the aliases held by the ID-to-alias map.
+    for (const auto &idToAliasElement : objectIdToAliasMap)
+        bytes += OwnedBytes(idToAliasElement.second);
+
+    return bytes;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::WriteLockShard(const Shard &shard) const
+{
+    return this->IsSharded() ? WriteLock{shard.m_mutex} : WriteLock{};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::WriteLockShards(const Shard &firstShard,
+                                                    const Shard &secondShard) const
+{
+    if (!this->IsSharded()) return ShardWriteLocks{};
+
+    if (&firstShard == &secondShard)
+        return ShardWriteLocks{WriteLock{firstShard.m_mutex}, WriteLock{}};
+
+    auto locks = ShardWriteLocks{WriteLock{firstShard.m_mutex, std::defer_lock},
+                                 WriteLock{secondShard.m_mutex, std::defer_lock}};
+
+    Lock<>::DoLock(locks.first, locks.second);
+    return locks;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline void ObjectRegistry<TBASE, TALIAS>::NotifyWrite() noexcept
+{
+    // The mode can only change under an exclusive lock, which excludes every writer.
+    if (m_isReadMostly.load(std::memory_order_relaxed))
+        m_version.fetch_add(SIZE_T(1UL), std::memory_order_release);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline void ObjectRegistry<TBASE, TALIAS>::RecordChange(const ChangeJournal::CHANGE change,
+                                                        const ID_t objectId) noexcept
+{
+    // The journal can only be swapped under an exclusive lock, which excludes every writer.
+    if (m_spChangeJournal) m_spChangeJournal->Record(change, objectId);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::BuildSnapshot() const -> Snapshot_cPtr
+{
+    // A write racing with the copy is labelled with a later version, so the copy will be stale.
+    auto spSnapshot = std::make_shared<Snapshot>();
+    spSnapshot->m_version = m_version.load(std::memory_order_acquire);
+
+    const auto shardLocks = this->ReadLockShards();
+
+    for (const auto &spShard : m_shards)
+    {
+        for (const auto &typeMapElement : spShard->m_objectTypeMap)
+        {
+            auto &bucket = spSnapshot->m_objectTypeMap[typeMapElement.first];
+
+            for (const auto &spObject : typeMapElement.second) bucket.push_back(spObject.get());
+        }
+
+        spShard->m_objectSlots.ForEach([&spSnapshot](const std::size_t, const ObjectSlot &slot) {
+            spSnapshot->m_objectSlots.Emplace(
+                slot.m_spObject->ID(),
+                ObjectSlot{slot.m_spObject, nullptr, SIZE_T(0UL), slot.m_typeTag});
+        });
+
+        for (const auto &idToAliasElement : spShard->m_objectIdToAliasMap)
+            spSnapshot->m_objectIdToAliasMap.insert(idToAliasElement);
+    }
+
+    // The alias keys must refer to the aliases held by the snapshot itself.
+    for (const auto &idToAliasElement : spSnapshot->m_objectIdToAliasMap)
+    {
+        spSnapshot->m_objectAliasToIdMap.emplace(AliasTraits::MakeKey(idToAliasElement.second),
+                                                 idToAliasElement.first);
+    }
+
+    return Snapshot_cPtr{std::move(spSnapshot)};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::LoadCurrentSnapshot() const noexcept -> Snapshot_cPtr
+{
+    // Writes are only counted in read-mostly mode, so only then can a snapshot be reused.
+    if (!m_isReadMostly.load(std::memory_order_acquire)) return Snapshot_cPtr{};
+
+    const auto version = m_version.load(std::memory_order_acquire);
+    return (m_spSnapshot && (m_spSnapshot->m_version == version)) ? m_spSnapshot : Snapshot_cPtr{};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::StoreSnapshot(const Snapshot_cPtr &spSnapshot) const noexcept
+    -> Snapshot_cPtr
+{
+    // Deletions bump the version before retiring the snapshot under the same mutex, so a copy that
+    // might hold deleted objects is never published after they have been withdrawn.
+    if (!m_isReadMostly.load(std::memory_order_acquire) ||
+        (spSnapshot->m_version != m_version.load(std::memory_order_acquire)))
+    {
+        return Snapshot_cPtr{};
+    }
+
+    m_snapshotSize.store(spSnapshot->m_objectSlots.Size(), std::memory_order_relaxed);
+    m_nStaleLookups.store(SIZE_T(0UL), std::memory_order_relaxed);
+    m_pSnapshot.store(spSnapshot.get(), std::memory_order_seq_cst);
+
+    auto spReplacedSnapshot = std::exchange(m_spSnapshot, spSnapshot);
+    if (spReplacedSnapshot) m_epochDomain.Synchronize();
+
+    return spReplacedSnapshot;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::RetireSnapshot() const noexcept -> Snapshot_cPtr
+{
+    if (!m_pSnapshot.load(std::memory_order_acquire)) return Snapshot_cPtr{};
+
+    const auto snapshotLock = WriteLock{m_snapshotMutex};
+    m_pSnapshot.store(nullptr, std::memory_order_seq_cst);
+
+    auto spRetiredSnapshot = std::move(m_spSnapshot);
+    m_spSnapshot.reset();
+    if (spRetiredSnapshot) m_epochDomain.Synchronize();
+
+    return spRetiredSnapshot;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::PublishSnapshot() const -> Snapshot_cPtr
+{
+    auto spReplacedSnapshot = Snapshot_cPtr{};  // released once the registry is unlocked
+    const auto lock = ReadLock{m_mutex};
+    const auto snapshotLock = WriteLock{m_snapshotMutex};
+
+    if (auto spSnapshot = this->LoadCurrentSnapshot()) return spSnapshot;
+
+    auto spSnapshot = this->BuildSnapshot();
+    spReplacedSnapshot = this->StoreSnapshot(spSnapshot);
+    return spSnapshot;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::AcquireSnapshot() const -> SnapshotGuard
+{
+    if (!m_isReadMostly.load(std::memory_order_acquire)) return SnapshotGuard{};
+
+    {
+        // Announce the epoch before reading the pointer, so that it cannot be withdrawn unseen.
+        auto readGuard = m_epochDomain.Enter();
+
+        if (readGuard.IsActive())
+        {
+            const auto pSnapshot = m_pSnapshot.load(std::memory_order_seq_cst);
+
+            if (pSnapshot && (pSnapshot->m_version == m_version.load(std::memory_order_acquire)))
+                return SnapshotGuard{pSnapshot, std::move(readGuard)};
+        }
+    }
+
+    // A lookup made within another must not replace the snapshot the outer one is reading.
+    if (m_epochDomain.IsReading()) return SnapshotGuard{};
+
+    // Count the locked lookups in per-thread batches (shared by the registries of this type), so
+    // that they do not all contend on the total.
+    thread_local auto nLocalStaleLookups = SIZE_T(0UL);
+    if (++nLocalStaleLookups < STALE_LOOKUP_BATCH) return SnapshotGuard{};
+
+    nLocalStaleLookups = SIZE_T(0UL);
+    const auto nStaleLookups =
+        m_nStaleLookups.fetch_add(STALE_LOOKUP_BATCH, std::memory_order_relaxed);
+    if (nStaleLookups < std::max(MIN_STALE_LOOKUPS, m_snapshotSize.load(std::memory_order_relaxed)))
+        return SnapshotGuard{};
+
+    // Only one lookup rebuilds the snapshot; the others go through the locks in the meantime.
+    auto spReplacedSnapshot = Snapshot_cPtr{};  // released once the registry is unlocked
+    const auto lock = ReadLock{m_mutex};
+    auto snapshotLock = WriteLock{m_snapshotMutex, std::try_to_lock};
+    if (!snapshotLock.GetLock().owns_lock()) return SnapshotGuard{};
+
+    if (auto spSnapshot = this->LoadCurrentSnapshot()) return SnapshotGuard{std::move(spSnapshot)};
+
+    auto spSnapshot = this->BuildSnapshot();
+    spReplacedSnapshot = this->StoreSnapshot(spSnapshot);
+    return SnapshotGuard{std::move(spSnapshot)};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TMAP>
+auto ObjectRegistry<TBASE, TALIAS>::MergeShardMaps(TMAP Shard::*pMap) const
+{
+    auto mergedMap = TMAP{};
+
+    for (const auto &spShard : m_shards)
+    {
+        const auto shardLock = this->ReadLockShard(*spShard);
+        const auto &shardMap = (*spShard).*pMap;
+        mergedMap.insert(shardMap.cbegin(), shardMap.cend());
+    }
+
+    return mergedMap;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::MergeShardSlots() const
+{
+    auto objectIdMap = ObjectIdMap{};
+
+    for (const auto &spShard : m_shards)
+    {
+        const auto shardLock = this->ReadLockShard(*spShard);
+        objectIdMap.reserve(objectIdMap.size() + spShard->m_objectSlots.Size());
+
+        spShard->m_objectSlots.ForEach([&objectIdMap](const std::size_t, const ObjectSlot &slot) {
+            objectIdMap.emplace(slot.m_spObject->ID(), slot.m_spObject);
+        });
+    }
+
+    return objectIdMap;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::MergeShardTypeMaps() const
+{
+    auto mergedTypeMap = ObjectTypeNameMap{};
+
+    for (const auto &spShard : m_shards)
+    {
+        const auto shardLock = this->ReadLockShard(*spShard);
+
+        for (const auto &typeMapElement : spShard->m_objectTypeMap)
+        {
+            auto &mergedBucket = mergedTypeMap[typeMapElement.first.name()];
+            mergedBucket.insert(mergedBucket.end(), typeMapElement.second.cbegin(),
+                                typeMapElement.second.cend());
+        }
+    }
+
+    return mergedTypeMap;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline ObjectRegistry<TBASE, TALIAS>::ObjectSlot::operator bool() const noexcept
+{
+    return static_cast<bool>(m_spObject);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline ObjectRegistry<TBASE, TALIAS>::SnapshotGuard::SnapshotGuard(
+    const Snapshot *const pSnapshot, EpochDomain::ReadGuard &&readGuard) noexcept
+    : m_pSnapshot{pSnapshot}, m_readGuard{std::move(readGuard)}, m_spSnapshot{}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline ObjectRegistry<TBASE, TALIAS>::SnapshotGuard::SnapshotGuard(
+    Snapshot_cPtr spSnapshot) noexcept
+    : m_pSnapshot{spSnapshot.get()}, m_readGuard{}, m_spSnapshot{std::move(spSnapshot)}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::SnapshotGuard::Get() const noexcept -> const Snapshot *
+{
+    return m_pSnapshot;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::SnapshotGuard::operator->() const noexcept
+    -> const Snapshot *
+{
+    return m_pSnapshot;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline ObjectRegistry<TBASE, TALIAS>::SnapshotGuard::operator bool() const noexcept
+{
+    return (m_pSnapshot != nullptr);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+void ObjectRegistry<TBASE, TALIAS>::AddToShard(Shard &shard, const std::type_index &typeIndex,
+                                               const TypeTag typeTag, TBASE_sPtr spObject)
+{
+    // Buckets are never erased, so the pointers held by the slots remain valid.
+    const auto slotIndex = this->SlotIndex(spObject->ID());
+    auto &bucket = shard.m_objectTypeMap[typeIndex];
+    bucket.push_back(spObject);
+
+    try
+    {
+        // Atomicity of ID requires that the slot be empty.
+        shard.m_objectSlots.Emplace(slotIndex, ObjectSlot{std::move(spObject), &bucket,
+                                                          bucket.size() - SIZE_T(1UL), typeTag});
+    }
+
+    catch (...)
+    {
+        bucket.pop_back();
+        throw;
+    }
+
+    this->NotifyWrite();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+void ObjectRegistry<TBASE, TALIAS>::RemoveFromTypeMap(Shard &shard,
+                                                      const ObjectSlot &slot) noexcept
+{
+    auto &bucket = *slot.m_pTypeBucket;
+    const auto position = slot.m_typePosition;
+
+    // Move the last object in the bucket into the vacated position and update its back-reference.
+    if (position + SIZE_T(1UL) != bucket.size())
+    {
+        bucket[position] = std::move(bucket.back());
+
+        const auto pMovedSlot = shard.m_objectSlots.Find(this->SlotIndex(bucket[position]->ID()));
+        KL_ASSERT(pMovedSlot, "Failed to find slot of object in type map");
+        pMovedSlot->m_typePosition = position;
+    }
+
+    bucket.pop_back();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::ExtractFromShard(Shard &shard, const ID_t objectId) noexcept
+    -> std::pair<TBASE_sPtr, ObjectIdToAliasNode>
+{
+    const auto slotIndex = this->SlotIndex(objectId);
+    const auto pSlot = shard.m_objectSlots.Find(slotIndex);
+    if (!pSlot) return std::make_pair(TBASE_sPtr{}, ObjectIdToAliasNode{});  // not found
+
+    this->RemoveFromTypeMap(shard, *pSlot);
+    auto spObject = std::move(shard.m_objectSlots.Erase(slotIndex).m_spObject);
+    this->NotifyWrite();
+    this->RecordChange(ChangeJournal::CHANGE::DELETED, objectId);
+    m_associationTable.DissociateAll(objectId);
+
+    // If it has an alias, extract its node from the ID-to-alias map without moving the alias.
+    return std::make_pair(std::move(spObject), shard.m_objectIdToAliasMap.extract(objectId));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+void ObjectRegistry<TBASE, TALIAS>::EraseAliasToId(const TALIAS_D &objectAlias) noexcept
+{
+    // The alias still maps to the removed ID, so it cannot have been claimed in the meantime.
+    const auto &aliasKey = AliasTraits::MakeKey(objectAlias);
+    auto &aliasShard = this->GetAliasShard(aliasKey);
+    const auto shardLock = this->WriteLockShard(aliasShard);
+
+    const auto aliasToIdFindIter =
+        aliasShard.m_objectAliasToIdMap.find(aliasKey);  // mechanics guarantees this be found
+    KL_ASSERT(aliasToIdFindIter != aliasShard.m_objectAliasToIdMap.end(),
+              "Failed to find entry in alias-to-ID map");
+    aliasShard.m_objectAliasToIdMap.erase(aliasToIdFindIter);
+    this->NotifyWrite();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+void ObjectRegistry<TBASE, TALIAS>::DeferRelease(TBASE_sPtr &spObject,
+                                                 ObjectIdToAliasNode &aliasNode) noexcept
+{
+    // Deferral can only be switched under an exclusive lock, which excludes every writer.
+    if (!m_isDeferringDeletion.load(std::memory_order_relaxed)) return;
+
+    const auto pendingLock = WriteLock{m_pendingMutex};
+
+    try
+    {
+        m_pendingDeletions.m_objects.reserve(m_pendingDeletions.m_objects.size() + SIZE_T(1UL));
+        if (aliasNode) m_pendingDeletions.m_aliasNodes.push_back(std::move(aliasNode));
+        m_pendingDeletions.m_objects.push_back(std::move(spObject));
+    }
+    catch (...)
+    {
+        // Out of memory: leave whatever was not taken for the caller to release.
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::InsertAlias(Shard &shard, const ID_t objectId,
+                                                TALIAS_D &&objectAlias)
+{
+    // Atomicity of ID requires that the map insertion be successful.
+    const auto idToAliasEmplaced =
+        shard.m_objectIdToAliasMap.emplace(objectId, std::move(objectAlias));
+    KL_ASSERT(idToAliasEmplaced.second, "Failed to append to ID-to-alias map");
+
+    const auto idToAliasIter = idToAliasEmplaced.first;
+
+    const auto &aliasKey = AliasTraits::MakeKey(idToAliasIter->second);
+    auto isInserted = false;
+
+    try
+    {
+        isInserted =
+            this->GetAliasShard(aliasKey).m_objectAliasToIdMap.emplace(aliasKey, objectId).second;
+    }
+
+    catch (...)
+    {
+        shard.m_objectIdToAliasMap.erase(idToAliasIter);
+        throw;
+    }
+
+    if (!isInserted) shard.m_objectIdToAliasMap.erase(idToAliasIter);
+    else this->NotifyWrite();
+
+    return isInserted;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+void ObjectRegistry<TBASE, TALIAS>::ReserveShards(const std::type_index &typeIndex,
+                                                  const std::size_t nNewObjects)
+{
+    const auto nNewObjectsPerShard = nNewObjects / m_shards.size() + SIZE_T(1UL);
+
+    for (const auto &spShard : m_shards)
+    {
+        spShard->m_objectSlots.Reserve(this->SlotIndex(m_idCount.load()) + SIZE_T(1UL));
+
+        auto &bucket = spShard->m_objectTypeMap[typeIndex];
+        bucket.reserve(bucket.size() + nNewObjectsPerShard);
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT, typename TMAKEOBJECT>
+auto ObjectRegistry<TBASE, TALIAS>::CreateManyImpl(const std::size_t count,
+                                                   TMAKEOBJECT &&makeObject)
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    auto objects = typename TOBJECT_D::RefVector{};
+    objects.reserve(count);
+
+    // Declared before the lock, so that objects rolled back are released after it.
+    auto spObjects = std::vector<std::shared_ptr<TOBJECT_D>>{};
+    spObjects.reserve(count);
+
+    // Holding the registry mutex exclusively, the shards need no locking of their own.
+    const auto lock = WriteLock{m_mutex};
+    const auto firstObjectId = m_idCount.fetch_add(count);
+
+    // Make every object before registering any, so that a throwing constructor or generator leaves
+    // the registry untouched (the IDs it was given stay consumed).
+    for (auto index = SIZE_T(0UL); index < count; ++index)
+    {
+        spObjects.push_back(makeObject(index, firstObjectId + index));
+        spObjects.back()->Initialize();
+    }
+
+    this->ReserveShards(typeid(TOBJECT_D), count);
+    auto nAdded = SIZE_T(0UL);
+
+    try
+    {
+        for (; nAdded < count; ++nAdded)
+            this->AddToShard<TOBJECT_D>(this->GetShard(firstObjectId + nAdded), spObjects[nAdded]);
+    }
+
+    catch (...)
+    {
+        for (auto index = SIZE_T(0UL); index < nAdded; ++index)
+            this->ExtractFromShard(this->GetShard(firstObjectId + index), firstObjectId + index);
+
+        throw;
+    }
+
+    for (const auto &spObject : spObjects) objects.emplace_back(*spObject);
+
+    return objects;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT, typename... TPARAMETERS>
+auto ObjectRegistry<TBASE, TALIAS>::MakeObject(const ID_t objectId, TPARAMETERS &&... parameters)
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+    auto wpThis = static_cast<ObjectRegistry::wPtr>(this->shared_from_this());
+
+    const auto arenaFindIter = m_objectArenaMap.find(typeid(TOBJECT_D));
+
+    if (arenaFindIter == m_objectArenaMap.cend())
+    {
+        return std::shared_ptr<TOBJECT_D>{new TOBJECT_D{std::move(wpThis), objectId, m_wpKoala,
+                                                        std::forward<TPARAMETERS>(parameters)...}};
+    }
+
+    // The control block is allocated straight after the object, in the same slab.
+    const auto &spArena = arenaFindIter->second;
+    void *const pBlock = spArena->Allocate(sizeof(TOBJECT_D));
+    TOBJECT_D *pObject = nullptr;
+
+    try
+    {
+        pObject = ::new (pBlock) TOBJECT_D{std::move(wpThis), objectId, m_wpKoala,
+                                           std::forward<TPARAMETERS>(parameters)...};
+    }
+
+    catch (...)
+    {
+        spArena->Deallocate(pBlock, sizeof(TOBJECT_D));
+        throw;
+    }
+
+    return std::shared_ptr<TOBJECT_D>{pObject, ArenaDeleter<TOBJECT_D>{spArena},
+                                      ArenaAllocator<TOBJECT_D>{spArena}};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+inline void ObjectRegistry<TBASE, TALIAS>::AddToShard(Shard &shard, const TBASE_sPtr &spObject)
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+    RecordObjectSize<TOBJECT_D>();
+    this->AddToShard(shard, typeid(TOBJECT_D), GetTypeTag<TOBJECT_D>(), spObject);
+    this->RecordChange(ChangeJournal::CHANGE::CREATED, spObject->ID());
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::FindSlot(const Snapshot *const pSnapshot,
+                                             const ID_t objectId) const -> ObjectSlot
+{
+    if (pSnapshot)
+    {
+        if (const auto pSlot = pSnapshot->m_objectSlots.Find(objectId)) return *pSlot;
+        return ObjectSlot{};
+    }
+
+    const auto &shard = this->GetShard(objectId);
+    const auto shardLock = this->ReadLockShard(shard);
+
+    if (const auto pSlot = shard.m_objectSlots.Find(this->SlotIndex(objectId))) return *pSlot;
+
+    return ObjectSlot{};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+inline auto ObjectRegistry<TBASE, TALIAS>::CastObject(const TBASE_sPtr &spObject,
+                                                      const TypeTag typeTag) noexcept
+    -> std::shared_ptr<std::decay_t<TOBJECT>>
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    if constexpr (std::is_base_of<TOBJECT_D, TBASE_D>::value)
+    {
+        static_cast<void>(typeTag);
+        return spObject;
+    }
+
+    else if constexpr (IsStaticallyCastable<TBASE_D, TOBJECT_D>::value)
+    {
+        // Only a query for a type other than the concrete type needs to walk the RTTI.
+        if (typeTag == GetTypeTag<TOBJECT_D>())
+            return std::static_pointer_cast<TOBJECT_D>(spObject);
+    }
+
+    return std::dynamic_pointer_cast<TOBJECT_D>(spObject);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+inline auto ObjectRegistry<TBASE, TALIAS>::CastObjectPointer(TBASE_D *const pObject,
+                                                             const TypeTag typeTag) noexcept
+    -> std::decay_t<TOBJECT> *
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    if constexpr (std::is_base_of<TOBJECT_D, TBASE_D>::value)
+    {
+        static_cast<void>(typeTag);
+        return pObject;
+    }
+
+    else if constexpr (IsStaticallyCastable<TBASE_D, TOBJECT_D>::value)
+    {
+        if (typeTag == GetTypeTag<TOBJECT_D>()) return static_cast<TOBJECT_D *>(pObject);
+    }
+
+    return dynamic_cast<TOBJECT_D *>(pObject);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT, typename TFUNCTION>
+void ObjectRegistry<TBASE, TALIAS>::ForEachBucketOfKind(TFUNCTION &&function) const
+{
+    // Every object in a bucket has the same concrete type, so any one of them stands for the rest.
+    for (const auto &spShard : m_shards)
+    {
+        const auto shardLock = this->ReadLockShard(*spShard);
+
+        for (const auto &typeMapElement : spShard->m_objectTypeMap)
+        {
+            const auto &bucket = typeMapElement.second;
+
+            if (!bucket.empty() && IsKindOf<TOBJECT>(typeMapElement.first, *bucket.front()))
+                function(typeMapElement.first, bucket);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+auto ObjectRegistry<TBASE, TALIAS>::CollectObjects() const
+{
+    auto objects = TBASE_sPtrVector{};
+
+    this->ForEachBucketOfKind<TOBJECT>(
+        [&objects](const std::type_index &, const TBASE_sPtrVector &bucket) {
+            objects.insert(objects.end(), bucket.cbegin(), bucket.cend());
+        });
+
+    return objects;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+auto ObjectRegistry<TBASE, TALIAS>::CollectObjectsInRange(const ID_t firstId,
+                                                          const ID_t lastId) const
+{
+    auto objects = TBASE_sPtrVector{};
+    if (firstId > lastId) return objects;
+
+    const auto nShards = m_shards.size();
+
+    for (auto shardIndex = SIZE_T(0UL); shardIndex < nShards; ++shardIndex)
+    {
+        // Slot i of this shard holds the object with ID i * nShards + shardIndex.
+        if (lastId < shardIndex) continue;
+
+        const auto firstOffset = (firstId > shardIndex) ? firstId - shardIndex : SIZE_T(0UL);
+        const auto firstSlotIndex = firstOffset / nShards +
+                                    ((firstOffset % nShards) ? SIZE_T(1UL) : SIZE_T(0UL));
+        const auto lastSlotIndex = (lastId - shardIndex) / nShards;
+
+        const auto &shard = *m_shards[shardIndex];
+        const auto shardLock = this->ReadLockShard(shard);
+
+        shard.m_objectSlots.ForEachInRange(
+            firstSlotIndex, lastSlotIndex, [&objects](const std::size_t, const ObjectSlot &slot) {
+                if (CastObjectPointer<TOBJECT>(slot.m_spObject.get(), slot.m_typeTag))
+                    objects.push_back(slot.m_spObject);
+            });
+    }
+
+    // Each shard yields its objects in ID order, so only interleaved shards need sorting.
+    if (nShards > SIZE_T(1UL))
+    {
+        std::sort(objects.begin(), objects.end(),
+                  [](const TBASE_sPtr &spLhs, const TBASE_sPtr &spRhs) {
+                      return spLhs->ID() < spRhs->ID();
+                  });
+    }
+
+    return objects;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::FindIdByAlias(const Snapshot *const pSnapshot,
+                                                  const AliasKey &aliasKey) const
+    -> std::optional<ID_t>
+{
+    if (pSnapshot)
+    {
+        const auto findIter = pSnapshot->m_objectAliasToIdMap.find(aliasKey);
+        if (findIter != pSnapshot->m_objectAliasToIdMap.cend()) return findIter->second;
+
+        return std::nullopt;
+    }
+
+    const auto &aliasShard = this->GetAliasShard(aliasKey);
+    const auto shardLock = this->ReadLockShard(aliasShard);
+
+    const auto findIter = aliasShard.m_objectAliasToIdMap.find(aliasKey);
+    if (findIter != aliasShard.m_objectAliasToIdMap.cend()) return findIter->second;
+
+    return std::nullopt;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -84,24 +964,22 @@ template <typename TTHISALIAS, typename TOBJECT>
 auto ObjectRegistry<TBASE, TALIAS>::AddSharedPointerByAlias(
     TTHISALIAS &&objectAlias, const std::shared_ptr<TOBJECT> &spObject)
 {
-    const auto spCastObject = TBASE_sPtr{spObject};
+    auto alias = TALIAS_D{std::forward<TTHISALIAS>(objectAlias)};
     const auto objectId = m_idCount++;
 
-    // Atomicity of ID requires that the map insertion be successful.
-    KL_ASSERT(m_objectIdMap.emplace(objectId, spCastObject).second,
-              "Failed to append to object ID map");
-    m_objectTypeMultiMap.emplace(typeid(std::decay_t<TOBJECT>).name(), spCastObject);
+    auto &shard = this->GetShard(objectId);
+    auto &aliasShard = this->GetAliasShard(alias);
+    const auto shardLocks = this->WriteLockShards(shard, aliasShard);
 
-    if (!m_objectAliasToIdMap.emplace(objectAlias, objectId).second)
+    if (!this->InsertAlias(shard, objectId, std::move(alias)))
     {
         KL_THROW("Could not add object of type " << KL_WHITE_BOLD << m_printableBaseName
                                                  << KL_NORMAL << " by given alias (alias "
                                                  << "already exists)");
     }
 
-    // Atomicity of ID requires that the map insertion be successful.
-    KL_ASSERT(m_objectIdToAliasMap.emplace(objectId, std::forward<TTHISALIAS>(objectAlias)).second,
-              "Failed to append to ID-to-alias map");
+    this->AddToShard<TOBJECT>(shard, TBASE_sPtr{spObject});
+    this->RecordChange(ChangeJournal::CHANGE::ALIAS_ADDED, objectId);
     return objectId;
 }
 
@@ -119,30 +997,27 @@ auto ObjectRegistry<TBASE, TALIAS>::CreateSharedPointerByAlias(TTHISALIAS &&obje
     //                                    decltype(std::forward<TPARAMETERS>(parameters))...>::value,
     //              "Incorrect constructor arguments passed to object registry");
 
-    const auto spObject = TBASE_sPtr{
-        new TOBJECT_D{static_cast<ObjectRegistry::wPtr>(this->shared_from_this()), m_idCount.load(),
-                      m_wpKoala, std::forward<TPARAMETERS>(parameters)...}};
+    auto alias = TALIAS_D{std::forward<TTHISALIAS>(objectAlias)};
+    const auto objectId = m_idCount++;
+
+    const auto spObject =
+        TBASE_sPtr{this->MakeObject<TOBJECT_D>(objectId, std::forward<TPARAMETERS>(parameters)...)};
 
     spObject->Initialize();
-    ++m_idCount;
 
-    // Atomicity of ID requires that the map insertion be successful.
-    KL_ASSERT(m_objectIdMap.emplace(spObject->ID(), spObject).second,
-              "Failed to append to object ID map");
-    m_objectTypeMultiMap.emplace(typeid(TOBJECT_D).name(), spObject);
+    auto &shard = this->GetShard(objectId);
+    auto &aliasShard = this->GetAliasShard(alias);
+    const auto shardLocks = this->WriteLockShards(shard, aliasShard);
 
-    if (!m_objectAliasToIdMap.emplace(objectAlias, spObject->ID()).second)
+    if (!this->InsertAlias(shard, objectId, std::move(alias)))
     {
         KL_THROW("Could not create object of type " << KL_WHITE_BOLD << m_printableBaseName
                                                     << KL_NORMAL << " by given alias (alias "
                                                     << "already exists)");
     }
 
-    // Atomicity of ID requires that the map insertion be successful.
-    KL_ASSERT(
-        m_objectIdToAliasMap.emplace(spObject->ID(), std::forward<TTHISALIAS>(objectAlias)).second,
-        "Failed to append to ID-to-alias map");
-
+    this->AddToShard<TOBJECT_D>(shard, spObject);
+    this->RecordChange(ChangeJournal::CHANGE::ALIAS_ADDED, objectId);
     return spObject;
 }
 
@@ -155,17 +1030,16 @@ auto ObjectRegistry<TBASE, TALIAS>::CreateSharedPointer(TPARAMETERS &&... parame
                                   TPARAMETERS...>::value)
 {
     using TOBJECT_D = std::decay_t<TOBJECT>;
-    const auto spObject = TBASE_sPtr{
-        new TOBJECT_D{static_cast<ObjectRegistry::wPtr>(this->shared_from_this()), m_idCount.load(),
-                      m_wpKoala, std::forward<TPARAMETERS>(parameters)...}};
+    const auto objectId = m_idCount++;
+
+    const auto spObject =
+        TBASE_sPtr{this->MakeObject<TOBJECT_D>(objectId, std::forward<TPARAMETERS>(parameters)...)};
 
     spObject->Initialize();
-    ++m_idCount;
 
-    // Atomicity of ID requires that the map insertion be successful.
-    KL_ASSERT(m_objectIdMap.emplace(spObject->ID(), spObject).second,
-              "Failed to append to object ID map");
-    m_objectTypeMultiMap.emplace(typeid(TOBJECT_D).name(), spObject);
+    auto &shard = this->GetShard(objectId);
+    const auto shardLock = this->WriteLockShard(shard);
+    this->AddToShard<TOBJECT_D>(shard, spObject);
 
     return spObject;
 }
@@ -176,9 +1050,7 @@ template <typename TBASE, typename TALIAS>
 template <typename T, typename>
 inline auto ObjectRegistry<TBASE, TALIAS>::GetSharedPointer(T &&arg) const
 {
-    return this->GetSharedPointerImpl(
-        std::forward<T>(arg),
-        typename std::is_same<TALIAS_D, std::decay_t<T>>::type());  // tag dispatch
+    return this->GetSlot(this->AcquireSnapshot().Get(), std::forward<T>(arg)).m_spObject;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -186,94 +1058,84 @@ inline auto ObjectRegistry<TBASE, TALIAS>::GetSharedPointer(T &&arg) const
 template <typename TBASE, typename TALIAS>
 inline auto ObjectRegistry<TBASE, TALIAS>::GetSharedPointer(const ID_t objectId) const
 {
-    const auto findIter = m_objectIdMap.find(objectId);
-    if (findIter != m_objectIdMap.cend()) return findIter->second;
-
-    KL_THROW("Could not find object of base type " << KL_WHITE_BOLD << m_printableBaseName
-                                                   << KL_NORMAL
-                                                   << " by the given ID: " << objectId);
+    return this->GetSlot(this->AcquireSnapshot().Get(), objectId).m_spObject;
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-auto ObjectRegistry<TBASE, TALIAS>::DeleteSharedPointer(
-    ObjectRegistry::TBASE_sPtr &&spObject) noexcept
+template <typename TOBJECT>
+inline auto ObjectRegistry<TBASE, TALIAS>::GetSharedPointer(const Handle<TOBJECT> &handle) const
 {
-    // Delete from ID map.
-    const auto idFindIter = m_objectIdMap.find(spObject->ID());
-    if (idFindIter == m_objectIdMap.cend()) return false;  // not found
+    return this->GetSharedPointer(handle.ID());
+}
 
-    m_objectIdMap.erase(idFindIter);
+//--------------------------------------------------------------------------------------------------
 
-    // Delete from the type map (the mechanics guarantees it be found singly).
-    for (auto iter = m_objectTypeMultiMap.cbegin(); iter != m_objectTypeMultiMap.cend();
-         /* no iterator */)
-    {
-        if (iter->second == spObject)
-        {
-            m_objectTypeMultiMap.erase(iter);
-            break;
-        }
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+inline auto ObjectRegistry<TBASE, TALIAS>::FindSharedPointer(const ID_t objectId) const
+    -> std::shared_ptr<std::decay_t<TOBJECT>>
+{
+    const auto snapshotGuard = this->AcquireSnapshot();
+    const auto pSnapshot = snapshotGuard.Get();
+    const auto lock = pSnapshot ? ReadLock{} : ReadLock{m_mutex};
+    const auto slot = this->FindSlot(pSnapshot, objectId);
+    return CastObject<TOBJECT>(slot.m_spObject, slot.m_typeTag);
+}
 
-        else
-            ++iter;
-    }
+//--------------------------------------------------------------------------------------------------
 
-    // If it has an alias, delete it from the other maps.
-    const auto idToAliasFindIter = m_objectIdToAliasMap.find(spObject->ID());
-    if (idToAliasFindIter == m_objectIdToAliasMap.cend()) return true;
+template <typename TBASE, typename TALIAS>
+template <typename T>
+inline auto ObjectRegistry<TBASE, TALIAS>::GetSlot(const Snapshot *const pSnapshot, T &&arg) const
+{
+    return this->GetSlotImpl(pSnapshot, std::forward<T>(arg),
+                             typename IsAliasKey<T>::type());  // tag dispatch
+}
 
-    const auto aliasToIdFindIter =
-        m_objectAliasToIdMap.find(idToAliasFindIter->second);  // mechanics guarantees this be found
-    KL_ASSERT(aliasToIdFindIter != m_objectAliasToIdMap, "Failed to find entry in alias-to-ID map");
+//--------------------------------------------------------------------------------------------------
 
-    m_objectAliasToIdMap.erase(aliasToIdFindIter);
-    m_objectIdToAliasMap.erase(idToAliasFindIter);
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::GetSlot(const Snapshot *const pSnapshot,
+                                                   const ID_t objectId) const
+{
+    if (auto slot = this->FindSlot(pSnapshot, objectId)) return slot;
 
-    return true;
+    KL_THROW("Could not find object of base type " << KL_WHITE_BOLD << m_printableBaseName
+                                                   << KL_NORMAL
+                                                   << " by the given ID: " << objectId);
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-template <typename TTHISALIAS>
-auto ObjectRegistry<TBASE, TALIAS>::DeleteImpl(TTHISALIAS &&objectAlias, std::true_type) noexcept
+inline auto ObjectRegistry<TBASE, TALIAS>::DeleteSharedPointer(
+    ObjectRegistry::TBASE_sPtr &&spObject) noexcept
 {
-    // Try to find it in the alias-to-ID map: return false if it can't be found.
-    const auto aliasToIdFindIter = m_objectAliasToIdMap.find(objectAlias);
-    if (aliasToIdFindIter == m_objectAliasToIdMap.cend()) return false;
+    auto spRemovedObject = TBASE_sPtr{};
+    return this->DeleteImpl(spObject->ID(), spRemovedObject);
+}
+
+//--------------------------------------------------------------------------------------------------
 
-    // We need to get the object ID so we can delete it from the ID map too.
-    const auto objectId = aliasToIdFindIter->second;
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::DeleteImpl(const ID_t objectId,
+                                               TBASE_sPtr &spRemovedObject) noexcept
+{
+    auto &shard = this->GetShard(objectId);
+    auto removed = std::pair<TBASE_sPtr, ObjectIdToAliasNode>{};
 
-    // Delete from the type map (the mechanics guarantees it be found singly).
-    for (auto iter = m_objectTypeMultiMap.cbegin(); iter != m_objectTypeMultiMap.cend();
-         /* no iterator */)
     {
-        if (iter->second->ID() == objectId)
-        {
-            m_objectTypeMultiMap.erase(iter);
-            break;
-        }
+        const auto shardLock = this->WriteLockShard(shard);
 
-        else
-            ++iter;
+        removed = this->ExtractFromShard(shard, objectId);
+        if (!removed.first) return false;  // not found
     }
 
-    // Object must have an alias.
-    const auto idMapFindIter =
-        m_objectIdMap.find(objectId);  // the mechanics guarantees this be found
-    KL_ASSERT(idMapFindIter != m_objectIdMap.end(), "Failed to find entry in object ID map");
-
-    m_objectIdMap.erase(idMapFindIter);
-    m_objectAliasToIdMap.erase(aliasToIdFindIter);
-
-    const auto idToAliasFindIter =
-        m_objectIdToAliasMap.find(objectId);  // the mechanics guarantees this be found
-    KL_ASSERT(idToAliasFindIter != m_objectIdToAliasMap.end(),
-              "Failed to find entry in ID-to-alias map");
-    m_objectIdToAliasMap.erase(idToAliasFindIter);
+    if (removed.second) this->EraseAliasToId(removed.second.mapped());
+    this->DeferRelease(removed.first, removed.second);
+    spRemovedObject = std::move(removed.first);
 
     // KL_IF_DEBUG_MESSAGE(KL_LIGHT_GREY << m_printableBaseName << KL_NORMAL
     //                                   << " registry deleted object with ID " << KL_WHITE_BOLD
@@ -284,51 +1146,37 @@ auto ObjectRegistry<TBASE, TALIAS>::DeleteImpl(TTHISALIAS &&objectAlias, std::tr
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-template <typename TOBJECT>
-auto ObjectRegistry<TBASE, TALIAS>::DeleteImpl(TOBJECT &&object, std::false_type) noexcept
+template <typename TTHISALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::DeleteImpl(TTHISALIAS &&objectAlias,
+                                               TBASE_sPtr &spRemovedObject,
+                                               std::true_type) noexcept
 {
-    const auto idFindIter = m_objectIdMap.find(object.ID());
-    if (idFindIter == m_objectIdMap.cend()) return false;
-
-    m_objectIdMap.erase(idFindIter);
-    const auto objectId = object.ID();
-
-    // Delete from the type map (the mechanics guarantees it be found singly).
-    const auto ret = m_objectTypeMultiMap.equal_range(typeid(TOBJECT).name());
-    for (auto iter = ret.first; iter != ret.second; ++iter)
-    {
-        if (iter->second->ID() == objectId)
-        {
-            m_objectTypeMultiMap.erase(iter);
-            break;
-        }
-    }
-
-    // If it has an alias, delete it from the other maps.
-    const auto idToAliasFindIter = m_objectIdToAliasMap.find(objectId);
-    if (idToAliasFindIter == m_objectIdToAliasMap.cend()) return true;
+    // Try to find it in the alias-to-ID map: return false if it can't be found.
+    if (const auto oObjectId = this->FindIdByAlias(nullptr, objectAlias))
+        return this->DeleteImpl(*oObjectId, spRemovedObject);
 
-    const auto alias = idToAliasFindIter->second;
-    m_objectIdToAliasMap.erase(idToAliasFindIter);
+    return false;
+}
 
-    const auto aliasToIdFindIter =
-        m_objectAliasToIdMap.find(alias);  // mechanics guarantees this be successful
-    KL_ASSERT(aliasToIdFindIter != m_objectAliasToIdMap.end(),
-              "Failed to find entry in alias-to-ID map");
-    m_objectAliasToIdMap.erase(aliasToIdFindIter);
+//--------------------------------------------------------------------------------------------------
 
-    return true;
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+inline auto ObjectRegistry<TBASE, TALIAS>::DeleteImpl(TOBJECT &&object,
+                                                      TBASE_sPtr &spRemovedObject,
+                                                      std::false_type) noexcept
+{
+    return this->DeleteImpl(object.ID(), spRemovedObject);
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
 template <typename TOBJECT>
-inline auto ObjectRegistry<TBASE, TALIAS>::GetSharedPointerImpl(TOBJECT &&object,
-                                                                std::false_type) const
+inline auto ObjectRegistry<TBASE, TALIAS>::GetSlotImpl(const Snapshot *const pSnapshot,
+                                                       TOBJECT &&object, std::false_type) const
 {
-    const auto findIter = m_objectIdMap.find(object.ID());
-    if (findIter != m_objectIdMap.cend()) return findIter->second;
+    if (auto slot = this->FindSlot(pSnapshot, object.ID())) return slot;
 
     KL_THROW("Could not find object by the given ID for object of base type "
              << KL_WHITE_BOLD << m_printableBaseName << KL_NORMAL << ": " << object.ID());
@@ -338,17 +1186,14 @@ inline auto ObjectRegistry<TBASE, TALIAS>::GetSharedPointerImpl(TOBJECT &&object
 
 template <typename TBASE, typename TALIAS>
 template <typename TTHISALIAS>
-inline auto ObjectRegistry<TBASE, TALIAS>::GetSharedPointerImpl(TTHISALIAS &&objectAlias,
-                                                                std::true_type) const
+inline auto ObjectRegistry<TBASE, TALIAS>::GetSlotImpl(const Snapshot *const pSnapshot,
+                                                       TTHISALIAS &&objectAlias,
+                                                       std::true_type) const
 {
-    const auto aliasFindIter = m_objectAliasToIdMap.find(objectAlias);
-    if (aliasFindIter != m_objectAliasToIdMap.cend())
+    if (const auto oObjectId = this->FindIdByAlias(pSnapshot, objectAlias))
     {
-        const auto idFindIter =
-            m_objectIdMap.find(aliasFindIter->second);  // the mechanics guarantees this be found
-        KL_ASSERT(idFindIter != m_objectIdMap.end(), "Failed to find entry");
-
-        return idFindIter->second;  // return the pointer
+        // Only absent if the object is concurrently being deleted from another shard.
+        if (auto slot = this->FindSlot(pSnapshot, *oObjectId)) return slot;
     }
 
     KL_THROW("Could not find object by the given alias for object of base type "
@@ -359,35 +1204,45 @@ inline auto ObjectRegistry<TBASE, TALIAS>::GetSharedPointerImpl(TTHISALIAS &&obj
 
 template <typename TBASE, typename TALIAS>
 template <typename TDESIRED, typename TOBJECT>
-inline auto ObjectRegistry<TBASE, TALIAS>::DoesObjectExistImpl(TOBJECT &&object,
+inline auto ObjectRegistry<TBASE, TALIAS>::DoesObjectExistImpl(const Snapshot *const pSnapshot,
+                                                               TOBJECT &&object,
                                                                std::false_type) const noexcept
 {
-    const auto findIter = m_objectIdMap.find(object.ID());
-    if (findIter == m_objectIdMap.cend()) return false;
-
-    return (std::dynamic_pointer_cast<std::decay_t<TDESIRED>>(findIter->second) != nullptr);
+    const auto slot = this->FindSlot(pSnapshot, object.ID());
+    return (CastObject<TDESIRED>(slot.m_spObject, slot.m_typeTag) != nullptr);
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
 template <typename TDESIRED, typename TTHISALIAS>
-inline auto ObjectRegistry<TBASE, TALIAS>::DoesObjectExistImpl(TTHISALIAS &&objectAlias,
+inline auto ObjectRegistry<TBASE, TALIAS>::DoesObjectExistImpl(const Snapshot *const pSnapshot,
+                                                               TTHISALIAS &&objectAlias,
                                                                std::true_type) const noexcept
 {
-    const auto aliasFindIter = m_objectAliasToIdMap.find(objectAlias);
-    if (aliasFindIter == m_objectAliasToIdMap.cend()) return false;
+    const auto oObjectId = this->FindIdByAlias(pSnapshot, objectAlias);
+    if (!oObjectId) return false;
 
-    return (std::dynamic_pointer_cast<std::decay_t<TDESIRED>>(
-                m_objectIdMap.find(aliasFindIter->second)->second) != nullptr);
+    const auto slot = this->FindSlot(pSnapshot, *oObjectId);
+    return (CastObject<TDESIRED>(slot.m_spObject, slot.m_typeTag) != nullptr);
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-inline auto ObjectRegistry<TBASE, TALIAS>::HasAliasImpl(const ID_t objectId) const noexcept
+inline auto ObjectRegistry<TBASE, TALIAS>::HasAliasImpl(const Snapshot *const pSnapshot,
+                                                        const ID_t objectId) const noexcept
 {
-    return (m_objectIdToAliasMap.find(objectId) != m_objectIdToAliasMap.cend());
+    if (pSnapshot)
+    {
+        return (pSnapshot->m_objectIdToAliasMap.find(objectId) !=
+                pSnapshot->m_objectIdToAliasMap.cend());
+    }
+
+    const auto &shard = this->GetShard(objectId);
+    const auto shardLock = this->ReadLockShard(shard);
+
+    return (shard.m_objectIdToAliasMap.find(objectId) != shard.m_objectIdToAliasMap.cend());
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -396,22 +1251,26 @@ template <typename TBASE, typename TALIAS>
 template <typename TTHISALIAS>
 inline void ObjectRegistry<TBASE, TALIAS>::AddAliasImpl(const ID_t objectId, TTHISALIAS &&alias)
 {
-    if (this->HasAliasImpl(objectId))
+    auto thisAlias = TALIAS_D{std::forward<TTHISALIAS>(alias)};
+
+    auto &shard = this->GetShard(objectId);
+    auto &aliasShard = this->GetAliasShard(thisAlias);
+    const auto shardLocks = this->WriteLockShards(shard, aliasShard);
+
+    if (shard.m_objectIdToAliasMap.find(objectId) != shard.m_objectIdToAliasMap.cend())
     {
         KL_THROW("Could not add alias for object of base type "
                  << KL_WHITE_BOLD << m_printableBaseName << KL_NORMAL << " because "
                  << "object already had an alias");
     }
 
-    if (!m_objectAliasToIdMap.emplace(alias, objectId).second)
+    if (!this->InsertAlias(shard, objectId, std::move(thisAlias)))
     {
         KL_THROW("Could not add given alias for object of base type "
                  << KL_WHITE_BOLD << m_printableBaseName << KL_NORMAL << " (alias already exists)");
     }
 
-    // Atomicity of ID requires that the map insertion be successful.
-    KL_ASSERT(m_objectIdToAliasMap.emplace(objectId, std::forward<TTHISALIAS>(alias)).second,
-              "Failed to append to ID-to-alias map");
+    this->RecordChange(ChangeJournal::CHANGE::ALIAS_ADDED, objectId);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -421,9 +1280,10 @@ template <typename TBASE, typename TALIAS>
 template <typename TARCHIVE>
 inline void ObjectRegistry<TBASE, TALIAS>::serialize(TARCHIVE &archive)
 {
+    const auto lock = ReadLock{m_mutex};
     archive(cereal::base_class<ObjectRegistryBase>(this), m_wpKoala, m_printableBaseName,
-            m_idCount.load(), m_objectIdMap, m_objectTypeMultiMap, m_objectAliasToIdMap,
-            m_objectIdToAliasMap);
+            m_idCount.load(), m_shardCount.load(), this->MergeShardSlots(),
+            this->MergeShardTypeMaps(), this->MergeShardMaps(&Shard::m_objectIdToAliasMap));
 }
 #endif  // #ifdef KOALA_ENABLE_CEREAL
 
@@ -438,54 +1298,343 @@ inline ObjectRegistry<TBASE, TALIAS>::ObjectRegistry() noexcept
       m_wpKoala{},
       m_printableBaseName{},
       m_idCount{SIZE_T(0UL)},
-      m_objectIdMap{},
-      m_objectTypeMultiMap{},
-      m_objectAliasToIdMap{},
-      m_objectIdToAliasMap{}
+      m_shardCount{SIZE_T(1UL)},
+      m_maxLoadFactor{1.0F},
+      m_shards{},
+      m_objectArenaMap{},
+      m_spChangeJournal{},
+      m_associationTable{},
+      m_isDeferringDeletion{false},
+      m_pendingMutex{},
+      m_pendingDeletions{},
+      m_isReadMostly{false},
+      m_version{SIZE_T(0UL)},
+      m_snapshotMutex{},
+      m_spSnapshot{},
+      m_pSnapshot{nullptr},
+      m_epochDomain{},
+      m_snapshotSize{SIZE_T(0UL)},
+      m_nStaleLookups{SIZE_T(0UL)}
+{
+    m_shards.emplace_back(this->MakeShard());
+}
+#endif  // #ifdef KOALA_ENABLE_CEREAL
+
+//--------------------------------------------------------------------------------------------------
+
+#ifdef KOALA_ENABLE_CEREAL
+template <typename TBASE, typename TALIAS>
+template <typename TARCHIVE>
+void ObjectRegistry<TBASE, TALIAS>::load_and_construct(
+    TARCHIVE &archive, cereal::construct<ObjectRegistry<TBASE, TALIAS>> &construct)
+{
+    auto wpKoala = Koala_wPtr{};
+    auto printableBaseName = std::string{};
+    auto idCount = SIZE_T(0UL);
+    auto shardCount = SIZE_T(1UL);
+
+    auto objectIdMap = ObjectIdMap{};
+    auto objectTypeMap = ObjectTypeNameMap{};
+    auto objectIdToAliasMap = ObjectIdToAliasMap{};
+
+    // Load archived variables and construct the object.
+    construct();
+    archive(cereal::base_class<ObjectRegistryBase>(construct->GetSharedPointer().get()), wpKoala,
+            printableBaseName, idCount, shardCount, objectIdMap, objectTypeMap, objectIdToAliasMap);
+
+    // The maps are loaded into the single default shard and then redistributed.
+    // Every object is in exactly one type bucket, from which its slot is rebuilt (keyed by its
+    // dynamic type, as type indices cannot be archived), and the alias index is rebuilt from the
+    // aliases interned in the ID-to-alias map.
+    auto &shard = *construct->m_shards.front();
+    construct->m_wpKoala = std::move(wpKoala);
+    construct->m_printableBaseName = std::move(printableBaseName);
+    for (auto &typeMapElement : objectTypeMap)
+    {
+        const auto typeTag = GetTypeTag(typeMapElement.first);
+
+        for (auto &spObject : typeMapElement.second)
+        {
+            // The association table is not saved, so its rows are restored from the objects.
+            spObject->RestoreAssociations(construct->m_associationTable);
+
+            const auto typeIndex = std::type_index{typeid(*spObject)};
+            construct->AddToShard(shard, typeIndex, typeTag, std::move(spObject));
+        }
+    }
+
+    shard.m_objectIdToAliasMap = std::move(objectIdToAliasMap);
+    for (const auto &idToAliasElement : shard.m_objectIdToAliasMap)
+    {
+        shard.m_objectAliasToIdMap.emplace(AliasTraits::MakeKey(idToAliasElement.second),
+                                           idToAliasElement.first);
+    }
+
+    construct->m_idCount.store(idCount);  // atomicity not guaranteed
+    construct->ShardCount(shardCount);
+}
+#endif  // #ifdef KOALA_ENABLE_CEREAL
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::PrintableBaseName() const noexcept -> std::string
+{
+    return m_printableBaseName;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::ShardCount() const noexcept
+{
+    return m_shardCount.load();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+void ObjectRegistry<TBASE, TALIAS>::ShardCount(const std::size_t shardCount)
+{
+    if (shardCount == SIZE_T(0UL))
+    {
+        KL_THROW("Could not set a shard count of zero for the registry of base type "
+                 << KL_WHITE_BOLD << m_printableBaseName);
+    }
+
+    const auto lock = WriteLock{m_mutex};
+    if (shardCount == m_shards.size()) return;
+
+    auto oldShards = ShardVector{};
+    oldShards.swap(m_shards);
+
+    for (auto shardIndex = SIZE_T(0UL); shardIndex < shardCount; ++shardIndex)
+        m_shards.emplace_back(this->MakeShard());
+
+    // Redistribute the entries: objects by ID (from their type buckets, which hold every object)
+    // and alias-to-ID entries by alias hash.
+    for (const auto &spOldShard : oldShards)
+    {
+        for (auto &typeMapElement : spOldShard->m_objectTypeMap)
+        {
+            for (auto &spObject : typeMapElement.second)
+            {
+                const auto oldSlotIndex = spObject->ID() / oldShards.size();
+                const auto pOldSlot = spOldShard->m_objectSlots.Find(oldSlotIndex);
+                KL_ASSERT(pOldSlot, "Failed to find slot of object in type map");
+
+                auto &shard = this->GetShard(spObject->ID());
+                this->AddToShard(shard, typeMapElement.first, pOldSlot->m_typeTag,
+                                 std::move(spObject));
+            }
+        }
+
+        for (auto &aliasToIdElement : spOldShard->m_objectAliasToIdMap)
+        {
+            this->GetAliasShard(aliasToIdElement.first)
+                .m_objectAliasToIdMap.emplace(std::move(aliasToIdElement));
+        }
+
+        // Move the ID-to-alias nodes whole, so the aliases that alias-to-ID keys refer to stay put.
+        auto &oldIdToAliasMap = spOldShard->m_objectIdToAliasMap;
+
+        while (!oldIdToAliasMap.empty())
+        {
+            auto idToAliasNode = oldIdToAliasMap.extract(oldIdToAliasMap.begin());
+            this->GetShard(idToAliasNode.key())
+                .m_objectIdToAliasMap.insert(std::move(idToAliasNode));
+        }
+    }
+
+    m_shardCount.store(shardCount);
+    this->NotifyWrite();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::ReadMostly() const noexcept
+{
+    return m_isReadMostly.load();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+void ObjectRegistry<TBASE, TALIAS>::ReadMostly(const bool isReadMostly)
+{
+    auto spRetiredSnapshot = Snapshot_cPtr{};  // released once the registry is unlocked
+    const auto lock = WriteLock{m_mutex};
+    if (isReadMostly == m_isReadMostly.load()) return;
+
+    // Bump the version so that no reader reuses a snapshot taken before the mode last changed.
+    m_version.fetch_add(SIZE_T(1UL), std::memory_order_release);
+    m_isReadMostly.store(isReadMostly, std::memory_order_release);
+
+    if (!isReadMostly) spRetiredSnapshot = this->RetireSnapshot();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+void ObjectRegistry<TBASE, TALIAS>::Reserve(const std::size_t nObjects, const std::size_t nAliases)
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    // Holding the registry mutex exclusively, the shards need no locking of their own.
+    const auto lock = WriteLock{m_mutex};
+    const auto nObjectsPerShard = nObjects / m_shards.size() + SIZE_T(1UL);
+    const auto nAliasesPerShard = nAliases / m_shards.size() + SIZE_T(1UL);
+    const auto lastSlotIndex = this->SlotIndex(m_idCount.load() + nObjects);
+
+    for (const auto &spShard : m_shards)
+    {
+        spShard->m_objectSlots.Reserve(lastSlotIndex + SIZE_T(1UL));
+
+        auto &bucket = spShard->m_objectTypeMap[typeid(TOBJECT_D)];
+        bucket.reserve(bucket.size() + nObjectsPerShard);
+
+        if (nAliases == SIZE_T(0UL)) continue;
+
+        auto &objectIdToAliasMap = spShard->m_objectIdToAliasMap;
+        objectIdToAliasMap.reserve(objectIdToAliasMap.size() + nAliasesPerShard);
+#ifndef KOALA_ORDERED_ALIAS_INDEX
+        auto &objectAliasToIdMap = spShard->m_objectAliasToIdMap;
+        objectAliasToIdMap.reserve(objectAliasToIdMap.size() + nAliasesPerShard);
+#endif  // #ifndef KOALA_ORDERED_ALIAS_INDEX
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::MaxLoadFactor() const
+{
+    const auto lock = ReadLock{m_mutex};
+    return m_maxLoadFactor;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+void ObjectRegistry<TBASE, TALIAS>::MaxLoadFactor(const float maxLoadFactor)
+{
+    if (!(maxLoadFactor > 0.0F))
+    {
+        KL_THROW("Could not set a maximum load factor of " << maxLoadFactor
+                                                           << " for the registry of base type "
+                                                           << KL_WHITE_BOLD << m_printableBaseName);
+    }
+
+    const auto lock = WriteLock{m_mutex};
+    m_maxLoadFactor = maxLoadFactor;
+
+    for (const auto &spShard : m_shards) this->ApplyMaxLoadFactor(*spShard);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::DeferDeletion() const noexcept
+{
+    return m_isDeferringDeletion.load();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+void ObjectRegistry<TBASE, TALIAS>::DeferDeletion(const bool isDeferringDeletion)
+{
+    {
+        const auto lock = WriteLock{m_mutex};
+        m_isDeferringDeletion.store(isDeferringDeletion);
+    }
+
+    if (!isDeferringDeletion) this->Compact();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto ObjectRegistry<TBASE, TALIAS>::Compact()
+{
+    auto pendingDeletions = PendingDeletions{};  // released once the pending mutex is unlocked
+
+    {
+        const auto pendingLock = WriteLock{m_pendingMutex};
+        std::swap(pendingDeletions, m_pendingDeletions);
+    }
+
+    return pendingDeletions.m_objects.size();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::PendingDeletionCount() const
+{
+    const auto pendingLock = ReadLock{m_pendingMutex};
+    return m_pendingDeletions.m_objects.size();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+void ObjectRegistry<TBASE, TALIAS>::EnableArena(const std::size_t chunkSize)
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+    static_assert(alignof(TOBJECT_D) <= alignof(std::max_align_t),
+                  "Cannot create over-aligned objects in an object arena");
+
+    const auto lock = WriteLock{m_mutex};
+    m_objectArenaMap[typeid(TOBJECT_D)] = std::make_shared<ObjectArena>(chunkSize);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+void ObjectRegistry<TBASE, TALIAS>::DisableArena()
 {
+    const auto lock = WriteLock{m_mutex};
+    m_objectArenaMap.erase(typeid(std::decay_t<TOBJECT>));
 }
-#endif  // #ifdef KOALA_ENABLE_CEREAL
 
 //--------------------------------------------------------------------------------------------------
 
-#ifdef KOALA_ENABLE_CEREAL
 template <typename TBASE, typename TALIAS>
-template <typename TARCHIVE>
-void ObjectRegistry<TBASE, TALIAS>::load_and_construct(
-    TARCHIVE &archive, cereal::construct<ObjectRegistry<TBASE, TALIAS>> &construct)
+void ObjectRegistry<TBASE, TALIAS>::EnableChangeJournal(const std::size_t capacity)
 {
-    auto wpKoala = Koala_wPtr{};
-    auto printableBaseName = std::string{};
-    auto idCount = SIZE_T(0UL);
+    if (capacity == SIZE_T(0UL))
+    {
+        KL_THROW("Could not enable change journal of zero capacity for object registry of "
+                 << "base type " << KL_WHITE_BOLD << m_printableBaseName);
+    }
 
-    auto objectIdMap = ObjectIdMap{};
-    auto objectTypeMultiMap = ObjectTypeMultiMap{};
-    auto objectAliasToIdMap = ObjectAliasToIdMap{};
-    auto objectIdToAliasMap = ObjectIdToAliasMap{};
+    auto spChangeJournal = std::make_shared<ChangeJournal>(capacity);
+    const auto lock = WriteLock{m_mutex};
+    m_spChangeJournal = std::move(spChangeJournal);
+}
 
-    // Load archived variables and construct the object.
-    construct();
-    archive(cereal::base_class<ObjectRegistryBase>(construct->GetSharedPointer().get()), wpKoala,
-            printableBaseName, idCount, objectIdMap, objectTypeMultiMap, objectAliasToIdMap,
-            objectIdToAliasMap);
+//--------------------------------------------------------------------------------------------------
 
-    construct->m_wpKoala = std::move(wpKoala);
-    construct->m_printableBaseName = std::move(printableBaseName);
-    construct->m_objectIdMap = std::move(objectIdMap);
-    construct->m_objectTypeMultiMap = std::move(objectTypeMultiMap);
-    construct->m_objectAliasToIdMap = std::move(objectAliasToIdMap);
-    construct->m_objectIdToAliasMap = std::move(objectIdToAliasMap);
-    construct->m_idCount.store(idCount);  // atomicity not guaranteed
+template <typename TBASE, typename TALIAS>
+void ObjectRegistry<TBASE, TALIAS>::DisableChangeJournal()
+{
+    const auto lock = WriteLock{m_mutex};
+    m_spChangeJournal.reset();
 }
-#endif  // #ifdef KOALA_ENABLE_CEREAL
 
-//--------------------------------------------------------------------------------------------------
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-inline auto ObjectRegistry<TBASE, TALIAS>::PrintableBaseName() const noexcept -> std::string
+inline auto ObjectRegistry<TBASE, TALIAS>::GetChangeJournal() const
 {
-    return m_printableBaseName;
+    const auto lock = ReadLock{m_mutex};
+    return m_spChangeJournal;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -498,7 +1647,7 @@ inline auto &ObjectRegistry<TBASE, TALIAS>::Create(TPARAMETERS &&... parameters)
     auto spObject = TBASE_sPtr{};
 
     {
-        const auto lock = WriteLock{m_mutex};
+        const auto locks = this->LockForWriting();
         spObject = this->CreateSharedPointer<TOBJECT_D>(std::forward<TPARAMETERS>(parameters)...);
     }
 
@@ -526,7 +1675,7 @@ inline auto &ObjectRegistry<TBASE, TALIAS>::CreateByAlias(TTHISALIAS &&objectAli
     auto spObject = TBASE_sPtr{};
 
     {
-        const auto lock = WriteLock{m_mutex};
+        const auto locks = this->LockForWriting();
         spObject = this->CreateSharedPointerByAlias<TOBJECT_D>(
             std::forward<TTHISALIAS>(objectAlias), std::forward<TPARAMETERS>(parameters)...);
     }
@@ -546,14 +1695,50 @@ inline auto &ObjectRegistry<TBASE, TALIAS>::CreateByAlias(TTHISALIAS &&objectAli
 
 //--------------------------------------------------------------------------------------------------
 
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT, typename... TPARAMETERS>
+inline auto ObjectRegistry<TBASE, TALIAS>::CreateMany(const std::size_t count,
+                                                      const TPARAMETERS &... parameters)
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    return this->CreateManyImpl<TOBJECT_D>(count, [&](const std::size_t, const ID_t objectId) {
+        return this->MakeObject<TOBJECT_D>(objectId, parameters...);
+    });
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT, typename TGENERATOR>
+inline auto ObjectRegistry<TBASE, TALIAS>::CreateManyFrom(const std::size_t count,
+                                                          TGENERATOR &&generator)
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    return this->CreateManyImpl<TOBJECT_D>(
+        count, [&](const std::size_t index, const ID_t objectId) {
+            return std::apply(
+                [&](auto &&... parameters) {
+                    return this->MakeObject<TOBJECT_D>(
+                        objectId, std::forward<decltype(parameters)>(parameters)...);
+                },
+                generator(index));
+        });
+}
+
+//--------------------------------------------------------------------------------------------------
+
 template <typename TBASE, typename TALIAS>
 template <typename TOBJECT, typename TTHISALIAS, typename>
 inline auto &ObjectRegistry<TBASE, TALIAS>::Get(TTHISALIAS &&objectAlias) const
 {
-    const auto lock = ReadLock{m_mutex};
-    const auto spObject = this->GetSharedPointer(std::forward<TTHISALIAS>(objectAlias));
+    const auto snapshotGuard = this->AcquireSnapshot();
+    const auto pSnapshot = snapshotGuard.Get();
+    const auto lock = pSnapshot ? ReadLock{} : ReadLock{m_mutex};
+    const auto slot = this->GetSlot(pSnapshot, std::forward<TTHISALIAS>(objectAlias));
 
-    if (const auto spCastObject = std::dynamic_pointer_cast<std::decay_t<TOBJECT>>(spObject))
+    if (const auto spCastObject = CastObject<TOBJECT>(slot.m_spObject, slot.m_typeTag))
         return *spCastObject;
 
     KL_THROW("The registry could not dynamically cast the called "
@@ -567,11 +1752,12 @@ template <typename TBASE, typename TALIAS>
 template <typename TOBJECT, typename>
 inline auto &ObjectRegistry<TBASE, TALIAS>::Get(TOBJECT &&object) const
 {
-    const auto lock = ReadLock{m_mutex};
-    using TOBJECT_D = std::decay_t<TOBJECT>;
-    const auto spObject = this->GetSharedPointer(std::forward<TOBJECT>(object));
+    const auto snapshotGuard = this->AcquireSnapshot();
+    const auto pSnapshot = snapshotGuard.Get();
+    const auto lock = pSnapshot ? ReadLock{} : ReadLock{m_mutex};
+    const auto slot = this->GetSlot(pSnapshot, std::forward<TOBJECT>(object));
 
-    if (const auto spCastObject = std::dynamic_pointer_cast<TOBJECT_D>(spObject))
+    if (const auto spCastObject = CastObject<TOBJECT>(slot.m_spObject, slot.m_typeTag))
         return *spCastObject;
 
     KL_THROW("The registry could not dynamically cast the called "
@@ -585,10 +1771,12 @@ template <typename TBASE, typename TALIAS>
 template <typename TOBJECT>
 inline auto &ObjectRegistry<TBASE, TALIAS>::Get(const ID_t objectId) const
 {
-    const auto lock = ReadLock{m_mutex};
-    const auto spObject = this->GetSharedPointer(objectId);
+    const auto snapshotGuard = this->AcquireSnapshot();
+    const auto pSnapshot = snapshotGuard.Get();
+    const auto lock = pSnapshot ? ReadLock{} : ReadLock{m_mutex};
+    const auto slot = this->GetSlot(pSnapshot, objectId);
 
-    if (const auto spCastObject = std::dynamic_pointer_cast<std::decay_t<TOBJECT>>(spObject))
+    if (const auto spCastObject = CastObject<TOBJECT>(slot.m_spObject, slot.m_typeTag))
         return *spCastObject;
 
     KL_THROW("The registry could not dynamically cast the called "
@@ -598,6 +1786,71 @@ inline auto &ObjectRegistry<TBASE, TALIAS>::Get(const ID_t objectId) const
 
 //--------------------------------------------------------------------------------------------------
 
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+inline auto &ObjectRegistry<TBASE, TALIAS>::Get(const Handle<TOBJECT> &handle) const
+{
+    if (const auto pObject = this->Resolve(handle)) return *pObject;
+
+    KL_THROW("Could not find object of base type " << KL_WHITE_BOLD << m_printableBaseName
+                                                   << KL_NORMAL
+                                                   << " by the given handle: " << handle.ID());
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+auto ObjectRegistry<TBASE, TALIAS>::Resolve(const Handle<TOBJECT> &handle) const
+    -> std::decay_t<TOBJECT> *
+{
+    // The slot is only looked at, never copied, so the object's reference count is left alone.
+    const auto objectId = handle.ID();
+
+    if (const auto snapshotGuard = this->AcquireSnapshot())
+    {
+        const auto pSlot = snapshotGuard->m_objectSlots.Find(objectId);
+        return pSlot ? CastObjectPointer<TOBJECT>(pSlot->m_spObject.get(), pSlot->m_typeTag)
+                     : nullptr;
+    }
+
+    const auto lock = ReadLock{m_mutex};
+    const auto &shard = this->GetShard(objectId);
+    const auto shardLock = this->ReadLockShard(shard);
+
+    const auto pSlot = shard.m_objectSlots.Find(this->SlotIndex(objectId));
+    return pSlot ? CastObjectPointer<TOBJECT>(pSlot->m_spObject.get(), pSlot->m_typeTag) : nullptr;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT, typename>
+inline auto ObjectRegistry<TBASE, TALIAS>::GetHandle(TOBJECT &&object) const noexcept
+{
+    return Handle<std::decay_t<TOBJECT>>{object.ID()};
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+inline auto ObjectRegistry<TBASE, TALIAS>::GetHandle(const ID_t objectId) const
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    if (!this->DoesObjectExist<TOBJECT_D>(objectId))
+    {
+        KL_THROW("Could not issue handle for object of base type "
+                 << KL_WHITE_BOLD << m_printableBaseName << KL_NORMAL << " with ID " << objectId
+                 << " (no such object of the desired type)");
+    }
+
+    return Handle<TOBJECT_D>{objectId};
+}
+
+//--------------------------------------------------------------------------------------------------
+
 template <typename TBASE, typename TALIAS>
 template <typename TOBJECT>
 auto ObjectRegistry<TBASE, TALIAS>::GetAllList() const noexcept
@@ -606,32 +1859,177 @@ auto ObjectRegistry<TBASE, TALIAS>::GetAllList() const noexcept
     using TOBJECT_D = std::decay_t<TOBJECT>;
 
     auto objectList = typename TOBJECT_D::UnorderedRefSet{};
-    const auto ret = m_objectTypeMultiMap.equal_range(typeid(TOBJECT_D).name());
 
-    for (auto iter = ret.first; iter != ret.second; ++iter)
+    this->ForEachBucketOfKind<TOBJECT_D>(
+        [&objectList](const std::type_index &, const TBASE_sPtrVector &bucket) {
+            // Every object in the bucket is known to be of the desired kind.
+            for (const auto &spObject : bucket)
+            {
+                if constexpr (IsStaticallyCastable<TBASE_D, TOBJECT_D>::value)
+                    objectList.insert(static_cast<TOBJECT_D &>(*spObject));
+                else
+                    objectList.insert(dynamic_cast<TOBJECT_D &>(*spObject));
+            }
+        });
+
+    return objectList;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+auto ObjectRegistry<TBASE, TALIAS>::GetAll() const
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    auto lock = ReadLock{m_mutex};
+    auto validityFunction = [](const TBASE_sPtr &) { return true; };
+    auto retrieverFunction = [](const TBASE_sPtr &spObject) { return spObject; };
+    auto getterFunction = [](const std::shared_ptr<TOBJECT_D> &spObject) -> auto & {
+        return *spObject;
+    };
+
+    // Writers to a sharded registry only share the registry lock, so the buckets must be copied.
+    if (this->IsSharded())
     {
-        if (const auto spCastObject = std::dynamic_pointer_cast<TOBJECT_D>(iter->second))
-            objectList.insert(*spCastObject);
+        return MakeRangeBasedContainer<TBASE_sPtrVector, TBASE_D, TOBJECT_D, TOBJECT_D>(
+            validityFunction, retrieverFunction, getterFunction, std::move(lock), ReadLock{},
+            this->template CollectObjects<TOBJECT_D>());
     }
 
-    return objectList;
+    // Otherwise the registry lock keeps the buckets unchanged, so the container views them.
+    auto pBuckets = std::vector<const TBASE_sPtrVector *>{};
+    this->ForEachBucketOfKind<TOBJECT_D>(
+        [&pBuckets](const std::type_index &, const TBASE_sPtrVector &bucket) {
+            pBuckets.push_back(&bucket);
+        });
+
+    return MakeRangeBasedContainer<TBASE_sPtrVector, TBASE_D, TOBJECT_D, TOBJECT_D>(
+        validityFunction, retrieverFunction, getterFunction, std::move(lock), ReadLock{},
+        std::move(pBuckets));
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
 template <typename TOBJECT>
-inline auto ObjectRegistry<TBASE, TALIAS>::GetAll() const
+inline auto ObjectRegistry<TBASE, TALIAS>::GetRange(const ID_t firstId, const ID_t lastId) const
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    // The container owns copies of the shared pointers, so it needs no lock once they are taken.
+    auto objects = [&]() {
+        const auto lock = ReadLock{m_mutex};
+        return this->template CollectObjectsInRange<TOBJECT_D>(firstId, lastId);
+    }();
+
+    return MakeRangeBasedContainer<TBASE_sPtrVector, TBASE_D, TOBJECT_D, TOBJECT_D>(
+        [](const TBASE_sPtr &) { return true; },
+        [](const TBASE_sPtr &spObject) { return spObject; },
+        [](const std::shared_ptr<TOBJECT_D> &spObject) -> auto & { return *spObject; }, ReadLock{},
+        ReadLock{}, std::move(objects));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+inline auto ObjectRegistry<TBASE, TALIAS>::GetAllOrdered() const
+{
+    return this->GetRange<TOBJECT>(SIZE_T(0UL));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT, typename TFUNCTION>
+auto ObjectRegistry<TBASE, TALIAS>::ParallelForEach(TFUNCTION &&function,
+                                                    const std::size_t nThreads) const
 {
-    const auto lock = ReadLock{m_mutex};
     using TOBJECT_D = std::decay_t<TOBJECT>;
-    return RangeBasedContainer<ObjectIdMap, TBASE_D, TOBJECT_D, TOBJECT_D>{
-        [](const typename ObjectIdMap::value_type &) { return true; },
-        [](const typename ObjectIdMap::value_type &mapElement) { return mapElement.second; },
-        [](const std::shared_ptr<TOBJECT_D> &spObject) -> auto &{return *spObject;
+
+    // Copy the matching objects under the locks and split each bucket into chunks; only buckets
+    // of exactly the requested type can be cast statically. The function is then called with no
+    // lock held, while the copies keep the objects alive.
+    auto objects = TBASE_sPtrVector{};
+    auto chunks = std::vector<ObjectChunk>{};
+
+    {
+        const auto lock = ReadLock{m_mutex};
+        const auto shardLocks = this->ReadLockShards();
+
+        for (const auto &spShard : m_shards)
+        {
+            for (const auto &typeMapElement : spShard->m_objectTypeMap)
+            {
+                const auto &bucket = typeMapElement.second;
+                if (bucket.empty() || !IsKindOf<TOBJECT_D>(typeMapElement.first, *bucket.front()))
+                    continue;
+
+                const auto typeTag = (typeMapElement.first == std::type_index{typeid(TOBJECT_D)})
+                                         ? GetTypeTag<TOBJECT_D>()
+                                         : UNKNOWN_TYPE_TAG;
+
+                for (auto begin = SIZE_T(0UL); begin < bucket.size(); begin += PARALLEL_CHUNK_SIZE)
+                {
+                    const auto end = std::min(begin + PARALLEL_CHUNK_SIZE, bucket.size());
+                    chunks.push_back(
+                        ObjectChunk{objects.size() + begin, objects.size() + end, typeTag});
+                }
+
+                objects.insert(objects.end(), bucket.cbegin(), bucket.cend());
+            }
+        }
+    }
+
+    // Each worker claims the next unprocessed chunk until none are left, so faster workers take
+    // on more chunks.
+    auto nextChunk = std::atomic<std::size_t>{SIZE_T(0UL)};
+    auto isAbandoned = std::atomic<bool>{false};
+    auto exceptionMutex = std::mutex{};
+    auto exceptionPtr = std::exception_ptr{};
+
+    const auto work = [&]() {
+        try
+        {
+            for (auto chunkIndex = nextChunk++; chunkIndex < chunks.size() && !isAbandoned.load();
+                 chunkIndex = nextChunk++)
+            {
+                const auto &chunk = chunks[chunkIndex];
+
+                for (auto position = chunk.m_begin; position < chunk.m_end; ++position)
+                {
+                    function(*ObjectRegistry::CastObjectPointer<TOBJECT_D>(
+                        objects[position].get(), chunk.m_typeTag));
+                }
+            }
+        }
+        catch (...)
+        {
+            const auto exceptionLock = std::lock_guard<std::mutex>{exceptionMutex};
+            if (!exceptionPtr) exceptionPtr = std::current_exception();
+            isAbandoned.store(true);
+        }
+    };
+
+    auto nWorkers = (nThreads == SIZE_T(0UL))
+                        ? static_cast<std::size_t>(std::thread::hardware_concurrency())
+                        : nThreads;
+    nWorkers = std::max(std::min(nWorkers, chunks.size()), SIZE_T(1UL));
+
+    WorkerPool::Get().Run(nWorkers, work);
+
+    if (exceptionPtr) std::rethrow_exception(exceptionPtr);
+    return objects.size();
 }
-, ReadLock{m_mutex}, ReadLock{}, m_objectIdMap
-};  // namespace kl
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::TakeSnapshot() const
+{
+    return RegistrySnapshot<TBASE, TALIAS>{this->shared_from_this(), this->PublishSnapshot()};
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -642,13 +2040,31 @@ auto ObjectRegistry<TBASE, TALIAS>::Count() const noexcept
 {
     const auto lock = ReadLock{m_mutex};
 
-    using TOBJECT_D = std::decay_t<TOBJECT>;
-    const auto ret = m_objectTypeMultiMap.equal_range(typeid(TOBJECT_D).name());
     auto count = SIZE_T(0UL);
 
-    for (auto iter = ret.first; iter != ret.second; ++iter)
+    this->ForEachBucketOfKind<TOBJECT>(
+        [&count](const std::type_index &, const TBASE_sPtrVector &bucket) {
+            count += bucket.size();
+        });
+
+    return count;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto ObjectRegistry<TBASE, TALIAS>::CountAll() const noexcept
+{
+    if (const auto snapshotGuard = this->AcquireSnapshot())
+        return snapshotGuard->m_objectSlots.Size();
+
+    const auto lock = ReadLock{m_mutex};
+    auto count = SIZE_T(0UL);
+
+    for (const auto &spShard : m_shards)
     {
-        if (std::dynamic_pointer_cast<TOBJECT_D>(iter->second)) ++count;
+        const auto shardLock = this->ReadLockShard(*spShard);
+        count += spShard->m_objectSlots.Size();
     }
 
     return count;
@@ -657,10 +2073,77 @@ auto ObjectRegistry<TBASE, TALIAS>::Count() const noexcept
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-inline auto ObjectRegistry<TBASE, TALIAS>::CountAll() const noexcept
+auto ObjectRegistry<TBASE, TALIAS>::MemoryUsage() const -> MemoryReport
 {
     const auto lock = ReadLock{m_mutex};
-    return m_objectIdMap.size();
+
+    auto memoryReport = MemoryReport{};
+    memoryReport.m_mutexBytes = (SIZE_T(4UL) + m_shards.size()) * sizeof(kl::Mutex);
+    memoryReport.m_indexBytes = sizeof(ObjectRegistry) - sizeof(AssociationTable) -
+                                SIZE_T(3UL) * sizeof(kl::Mutex) + OwnedBytes(m_printableBaseName) +
+                                VectorBytes(m_shards) + m_epochDomain.MemoryBytes() -
+                                sizeof(EpochDomain);
+    memoryReport.m_associationBytes = m_associationTable.MemoryBytes();
+
+    if (m_spChangeJournal) memoryReport.m_indexBytes += m_spChangeJournal->MemoryBytes();
+
+    // The published snapshot is immutable, so it can be read once the pointer is copied.
+    auto spSnapshot = Snapshot_cPtr{};
+
+    {
+        const auto snapshotLock = ReadLock{m_snapshotMutex};
+        spSnapshot = m_spSnapshot;
+    }
+
+    if (spSnapshot)
+    {
+        memoryReport.m_indexBytes +=
+            sizeof(Snapshot) + CONTROL_BLOCK_BYTES + spSnapshot->m_objectSlots.MemoryBytes() +
+            HashContainerBytes(spSnapshot->m_objectTypeMap) +
+            AliasMapBytes(spSnapshot->m_objectAliasToIdMap, spSnapshot->m_objectIdToAliasMap);
+
+        for (const auto &typeMapElement : spSnapshot->m_objectTypeMap)
+            memoryReport.m_indexBytes += VectorBytes(typeMapElement.second);
+    }
+
+    // Each object's own report covers its mutexes, which are part of its size, so they are taken
+    // out of the payload. Objects of types the registry never created are sized as the base.
+    const auto addObject = [&memoryReport](const TBASE_sPtr &spObject, const std::size_t size) {
+        const auto objectReport = spObject->MemoryUsage();
+        memoryReport += objectReport;
+        memoryReport.m_objectBytes += size + CONTROL_BLOCK_BYTES - objectReport.m_mutexBytes;
+    };
+
+    const auto shardLocks = this->ReadLockShards();
+
+    for (const auto &spShard : m_shards)
+    {
+        memoryReport.m_indexBytes +=
+            sizeof(Shard) - sizeof(kl::Mutex) + spShard->m_objectSlots.MemoryBytes() +
+            HashContainerBytes(spShard->m_objectTypeMap) +
+            AliasMapBytes(spShard->m_objectAliasToIdMap, spShard->m_objectIdToAliasMap);
+
+        for (const auto &typeMapElement : spShard->m_objectTypeMap)
+        {
+            const auto &bucket = typeMapElement.second;
+            const auto size = RecordedObjectSize(typeMapElement.first, sizeof(TBASE_D));
+            memoryReport.m_indexBytes += VectorBytes(bucket);
+
+            for (const auto &spObject : bucket) addObject(spObject, size);
+        }
+    }
+
+    const auto pendingLock = ReadLock{m_pendingMutex};
+    memoryReport.m_indexBytes += VectorBytes(m_pendingDeletions.m_objects) +
+                                 VectorBytes(m_pendingDeletions.m_aliasNodes) +
+                                 m_pendingDeletions.m_aliasNodes.size() *
+                                     (sizeof(typename ObjectIdToAliasMap::value_type) +
+                                      sizeof(void *) + sizeof(std::size_t));
+
+    for (const auto &spObject : m_pendingDeletions.m_objects)
+        addObject(spObject, RecordedObjectSize(typeid(*spObject), sizeof(TBASE_D)));
+
+    return memoryReport;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -669,55 +2152,114 @@ template <typename TBASE, typename TALIAS>
 template <typename T, typename>
 inline auto ObjectRegistry<TBASE, TALIAS>::Delete(T &&arg) noexcept
 {
-    const auto lock = WriteLock{m_mutex};
-    return this->DeleteImpl(
-        std::forward<T>(arg),
-        typename std::is_same<TALIAS_D, std::decay_t<T>>::type());  // tag dispatch
+    auto spRemovedObject = TBASE_sPtr{};  // released once the registry is unlocked
+    auto spRetiredSnapshot = Snapshot_cPtr{};
+    const auto locks = this->LockForWriting();
+
+    if (!this->DeleteImpl(std::forward<T>(arg), spRemovedObject,
+                          typename IsAliasKey<T>::type()))  // tag dispatch
+    {
+        return false;
+    }
+
+    spRetiredSnapshot = this->RetireSnapshot();
+    return true;
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-auto ObjectRegistry<TBASE, TALIAS>::Delete(const ID_t objectId) noexcept
+inline auto ObjectRegistry<TBASE, TALIAS>::Delete(const ID_t objectId) noexcept
 {
-    const auto lock = WriteLock{m_mutex};
+    auto spRemovedObject = TBASE_sPtr{};  // released once the registry is unlocked
+    auto spRetiredSnapshot = Snapshot_cPtr{};
+    const auto locks = this->LockForWriting();
+
+    if (!this->DeleteImpl(objectId, spRemovedObject)) return false;
+
+    spRetiredSnapshot = this->RetireSnapshot();
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+inline auto ObjectRegistry<TBASE, TALIAS>::Delete(const Handle<TOBJECT> &handle) noexcept
+{
+    return this->Delete(handle.ID());
+}
 
-    // Delete from ID map.
-    const auto idFindIter = m_objectIdMap.find(objectId);
-    if (idFindIter == m_objectIdMap.cend()) return false;  // not found
+//--------------------------------------------------------------------------------------------------
 
-    m_objectIdMap.erase(idFindIter);
+template <typename TBASE, typename TALIAS>
+template <typename TPREDICATE>
+auto ObjectRegistry<TBASE, TALIAS>::DeleteIf(TPREDICATE &&predicate)
+{
+    auto removedObjects = TBASE_sPtrVector{};  // released once the registry is unlocked
+    auto spRetiredSnapshot = Snapshot_cPtr{};
+    const auto lock = WriteLock{m_mutex};
+    auto nDeleted = SIZE_T(0UL);
 
-    // Delete from the type map (the mechanics guarantees it be found singly).
-    for (auto iter = m_objectTypeMultiMap.cbegin(); iter != m_objectTypeMultiMap.cend();
-         /* no iterator */)
+    for (const auto &spShard : m_shards)
     {
-        if (iter->second->ID() == objectId)
+        // Slots cannot be erased while iterating over them, so collect the matching IDs first.
+        auto objectIds = std::vector<ID_t>{};
+
+        spShard->m_objectSlots.ForEach([&](const std::size_t, const ObjectSlot &slot) {
+            if (predicate(static_cast<const TBASE_D &>(*slot.m_spObject)))
+                objectIds.push_back(slot.m_spObject->ID());
+        });
+
+        for (const auto objectId : objectIds)
         {
-            m_objectTypeMultiMap.erase(iter);
-            break;
+            auto removed = this->ExtractFromShard(*spShard, objectId);
+
+            if (removed.second) this->EraseAliasToId(removed.second.mapped());
+            this->DeferRelease(removed.first, removed.second);
+            if (removed.first) removedObjects.push_back(std::move(removed.first));
+            ++nDeleted;
         }
+    }
 
-        else
-            ++iter;
+    if (nDeleted > SIZE_T(0UL)) spRetiredSnapshot = this->RetireSnapshot();
+    return nDeleted;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TIDS>
+auto ObjectRegistry<TBASE, TALIAS>::DeleteMany(const TIDS &objectIds) noexcept
+{
+    auto removedObjects = TBASE_sPtrVector{};  // released once the registry is unlocked
+
+    try
+    {
+        removedObjects.reserve(std::size(objectIds));
+    }
+    catch (...)
+    {
+        // Out of memory: the objects that do not fit are released under the lock.
     }
 
-    // If it has an alias, delete it from the other maps.
-    const auto idToAliasFindIter = m_objectIdToAliasMap.find(objectId);
-    if (idToAliasFindIter == m_objectIdToAliasMap.cend()) return true;
+    auto spRetiredSnapshot = Snapshot_cPtr{};
+    const auto lock = WriteLock{m_mutex};
+    auto nDeleted = SIZE_T(0UL);
 
-    const auto aliasToIdFindIter =
-        m_objectAliasToIdMap.find(idToAliasFindIter->second);  // mechanics guarantees this be found
-    KL_ASSERT(aliasToIdFindIter != m_objectAliasToIdMap.end(),
-              "Failed to find entry in alias-to-ID map");
+    for (const auto objectId : objectIds)
+    {
+        auto spRemovedObject = TBASE_sPtr{};
+        if (!this->DeleteImpl(objectId, spRemovedObject)) continue;
 
-    m_objectAliasToIdMap.erase(aliasToIdFindIter);
-    m_objectIdToAliasMap.erase(idToAliasFindIter);
+        if (spRemovedObject && (removedObjects.size() < removedObjects.capacity()))
+            removedObjects.push_back(std::move(spRemovedObject));
 
-    // KL_IF_DEBUG_MESSAGE(KL_LIGHT_GREY << m_printableBaseName << KL_NORMAL
-    //                                   << " registry deleted object with ID " << KL_WHITE_BOLD
-    //                                   << objectId);
-    return true;
+        ++nDeleted;
+    }
+
+    if (nDeleted > SIZE_T(0UL)) spRetiredSnapshot = this->RetireSnapshot();
+    return nDeleted;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -725,11 +2267,40 @@ auto ObjectRegistry<TBASE, TALIAS>::Delete(const ID_t objectId) noexcept
 template <typename TBASE, typename TALIAS>
 inline void ObjectRegistry<TBASE, TALIAS>::DeleteAll() noexcept
 {
+    auto spRetiredSnapshot = Snapshot_cPtr{};  // released once the registry is unlocked
     const auto lock = WriteLock{m_mutex};
-    m_objectIdMap.clear();
-    m_objectTypeMultiMap.clear();
-    m_objectAliasToIdMap.clear();
-    m_objectIdToAliasMap.clear();
+
+    if (m_isDeferringDeletion.load(std::memory_order_relaxed))
+    {
+        const auto pendingLock = WriteLock{m_pendingMutex};
+
+        try
+        {
+            for (const auto &spShard : m_shards)
+            {
+                spShard->m_objectSlots.ForEach([&](const std::size_t, const ObjectSlot &slot) {
+                    m_pendingDeletions.m_objects.push_back(slot.m_spObject);
+                });
+            }
+        }
+        catch (...)
+        {
+            // Out of memory: the objects not taken are released below.
+        }
+    }
+
+    for (const auto &spShard : m_shards)
+    {
+        spShard->m_objectSlots.Clear();
+        spShard->m_objectTypeMap.clear();
+        spShard->m_objectAliasToIdMap.clear();
+        spShard->m_objectIdToAliasMap.clear();
+    }
+
+    m_associationTable.Clear();
+    this->NotifyWrite();
+    this->RecordChange(ChangeJournal::CHANGE::CLEARED, SIZE_T(0UL));
+    spRetiredSnapshot = this->RetireSnapshot();
 
     // KL_IF_DEBUG_MESSAGE(KL_LIGHT_GREY << m_printableBaseName << KL_NORMAL
     //                                   << " registry deleted all objects");
@@ -741,7 +2312,6 @@ template <typename TBASE, typename TALIAS>
 template <typename TOBJECT, typename>
 inline auto ObjectRegistry<TBASE, TALIAS>::GetAlias(TOBJECT &&object) const
 {
-    const auto lock = ReadLock{m_mutex};
     return this->GetAlias(object.ID());
 }
 
@@ -750,10 +2320,22 @@ inline auto ObjectRegistry<TBASE, TALIAS>::GetAlias(TOBJECT &&object) const
 template <typename TBASE, typename TALIAS>
 inline auto ObjectRegistry<TBASE, TALIAS>::GetAlias(const ID_t objectId) const
 {
-    const auto lock = ReadLock{m_mutex};
+    if (const auto snapshotGuard = this->AcquireSnapshot())
+    {
+        const auto findIter = snapshotGuard->m_objectIdToAliasMap.find(objectId);
+        if (findIter != snapshotGuard->m_objectIdToAliasMap.cend()) return findIter->second;
+    }
 
-    const auto findIter = m_objectIdToAliasMap.find(objectId);
-    if (findIter != m_objectIdToAliasMap.cend()) return findIter->second;
+    else
+    {
+        const auto lock = ReadLock{m_mutex};
+
+        const auto &shard = this->GetShard(objectId);
+        const auto shardLock = this->ReadLockShard(shard);
+
+        const auto findIter = shard.m_objectIdToAliasMap.find(objectId);
+        if (findIter != shard.m_objectIdToAliasMap.cend()) return findIter->second;
+    }
 
     KL_THROW("Could not return object alias because the " << KL_WHITE_BOLD << m_printableBaseName
                                                           << KL_NORMAL << " object did not "
@@ -766,8 +2348,10 @@ template <typename TBASE, typename TALIAS>
 template <typename TOBJECT, typename>
 inline auto ObjectRegistry<TBASE, TALIAS>::HasAlias(TOBJECT &&object) const noexcept
 {
-    const auto lock = ReadLock{m_mutex};
-    return this->HasAliasImpl(object.ID());
+    const auto snapshotGuard = this->AcquireSnapshot();
+    const auto pSnapshot = snapshotGuard.Get();
+    const auto lock = pSnapshot ? ReadLock{} : ReadLock{m_mutex};
+    return this->HasAliasImpl(pSnapshot, object.ID());
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -775,8 +2359,10 @@ inline auto ObjectRegistry<TBASE, TALIAS>::HasAlias(TOBJECT &&object) const noex
 template <typename TBASE, typename TALIAS>
 inline auto ObjectRegistry<TBASE, TALIAS>::HasAlias(const ID_t objectId) const noexcept
 {
-    const auto lock = ReadLock{m_mutex};
-    return this->HasAliasImpl(objectId);
+    const auto snapshotGuard = this->AcquireSnapshot();
+    const auto pSnapshot = snapshotGuard.Get();
+    const auto lock = pSnapshot ? ReadLock{} : ReadLock{m_mutex};
+    return this->HasAliasImpl(pSnapshot, objectId);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -785,8 +2371,8 @@ template <typename TBASE, typename TALIAS>
 template <typename TOBJECT, typename TTHISALIAS, typename>
 inline void ObjectRegistry<TBASE, TALIAS>::AddAlias(TOBJECT &&object, TTHISALIAS &&alias)
 {
-    const auto lock = WriteLock{m_mutex};
-    this->AddAliasImpl(object.ID(), std::forward<TALIAS>(alias));
+    const auto locks = this->LockForWriting();
+    this->AddAliasImpl(object.ID(), std::forward<TTHISALIAS>(alias));
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -795,8 +2381,8 @@ template <typename TBASE, typename TALIAS>
 template <typename TTHISALIAS>
 inline void ObjectRegistry<TBASE, TALIAS>::AddAlias(const ID_t objectId, TTHISALIAS &&alias)
 {
-    const auto lock = WriteLock{m_mutex};
-    this->AddAliasImpl(objectId, std::forward<TALIAS>(alias));
+    const auto locks = this->LockForWriting();
+    this->AddAliasImpl(objectId, std::forward<TTHISALIAS>(alias));
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -805,10 +2391,12 @@ template <typename TBASE, typename TALIAS>
 template <typename TDESIRED, typename T, typename>
 inline auto ObjectRegistry<TBASE, TALIAS>::DoesObjectExist(T &&arg) const noexcept
 {
-    const auto lock = ReadLock{m_mutex};
+    const auto snapshotGuard = this->AcquireSnapshot();
+    const auto pSnapshot = snapshotGuard.Get();
+    const auto lock = pSnapshot ? ReadLock{} : ReadLock{m_mutex};
     return this->DoesObjectExistImpl<std::decay_t<TDESIRED>>(
-        std::forward<T>(arg),
-        typename std::is_same<TALIAS_D, std::decay_t<T>>::type());  // tag dispatch
+        pSnapshot, std::forward<T>(arg),
+        typename IsAliasKey<T>::type());  // tag dispatch
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -817,13 +2405,12 @@ template <typename TBASE, typename TALIAS>
 template <typename TDESIRED>
 inline auto ObjectRegistry<TBASE, TALIAS>::DoesObjectExist(const ID_t objectId) const noexcept
 {
-    const auto lock = ReadLock{m_mutex};
-
-    const auto findIter = m_objectIdMap.find(objectId);
-    if (findIter == m_objectIdMap.cend()) return false;
-
-    return (std::dynamic_pointer_cast<std::decay_t<TDESIRED>>(findIter->second) != nullptr);
+    const auto snapshotGuard = this->AcquireSnapshot();
+    const auto pSnapshot = snapshotGuard.Get();
+    const auto lock = pSnapshot ? ReadLock{} : ReadLock{m_mutex};
+    const auto slot = this->FindSlot(pSnapshot, objectId);
+    return (CastObject<TDESIRED>(slot.m_spObject, slot.m_typeTag) != nullptr);
 }
 }  // namespace kl
 
-#endif  // #ifndef KL_OBJECT_REGISTRY_IMPL_H
\ No newline at end of file
+#endif  // #ifndef KL_OBJECT_REGISTRY_IMPL_H
@@ -0,0 +1,366 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/include/koala/Registry/PagedSlotVector.h
+ *
+ * @brief Header file for the paged slot vector (PagedSlotVector) class template.
+ */
+
+#ifndef KL_PAGED_SLOT_VECTOR_H
+#define KL_PAGED_SLOT_VECTOR_H 1
+
+#include "koala/Definitions.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace kl
+{
+/**
+ * @brief PagedSlotVector class template. A dense vector of slots indexed directly by integer key
+ * and split into fixed-size pages. A value-initialized slot is a tombstone and slots must be
+ * contextually convertible to bool, being true only when occupied. Pages are allocated on first
+ * use and returned to a free list once all of their slots are tombstones.
+ */
+template <typename T, std::size_t PAGE_SIZE = SIZE_T(1024UL)>
+class PagedSlotVector
+{
+public:
+    static_assert(PAGE_SIZE > SIZE_T(0UL), "The page size of a paged slot vector must be non-zero");
+
+    /**
+     * @brief Default constructor.
+     */
+    PagedSlotVector() = default;
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    PagedSlotVector(const PagedSlotVector &) = delete;
+
+    /**
+     * @brief Default move constructor.
+     */
+    PagedSlotVector(PagedSlotVector &&) = default;
+
+    /**
+     * @brief Deleted copy assignment operator.
+     */
+    PagedSlotVector &operator=(const PagedSlotVector &) = delete;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    PagedSlotVector &operator=(PagedSlotVector &&) = default;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~PagedSlotVector() = default;
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief Find the occupied slot with a given index.
+     *
+     * @param index The index of the slot.
+     *
+     * @return Pointer to the slot (null if the slot is a tombstone).
+     */
+    T *Find(const std::size_t index) noexcept;
+
+    /**
+     * @brief Find the occupied slot with a given index.
+     *
+     * @param index The index of the slot.
+     *
+     * @return Pointer to the slot (null if the slot is a tombstone).
+     */
+    const T *Find(const std::size_t index) const noexcept;
+
+    /**
+     * @brief Fill the slot with a given index, which must be a tombstone.
+     *
+     * @param index The index of the slot.
+     * @param value The (occupied) value with which to fill the slot.
+     *
+     * @return The filled slot.
+     */
+    T &Emplace(const std::size_t index, T value);
+
+    /**
+     * @brief Turn the slot with a given index into a tombstone.
+     *
+     * @param index The index of the slot.
+     *
+     * @return The value that the slot held, or a tombstone if it held none.
+     */
+    T Erase(const std::size_t index) noexcept;
+
+    /**
+     * @brief Turn every slot into a tombstone, releasing all the pages.
+     */
+    void Clear() noexcept;
+
+    /**
+     * @brief Reserve the page table for a given number of slots.
+     *
+     * @param size The number of slots.
+     */
+    void Reserve(const std::size_t size);
+
+    /**
+     * @brief Call a function on every occupied slot, in index order. The function must not add or
+     * remove slots.
+     *
+     * @param function The function, taking the slot index and a reference to the slot.
+     */
+    template <typename TFUNCTION>
+    void ForEach(TFUNCTION &&function) const;
+
+    /**
+     * @brief Call a function on every occupied slot with an index in a given range, in index order,
+     * skipping the pages that were never allocated. The function must not add or remove slots.
+     *
+     * @param first The index of the first slot in the range.
+     * @param last The index of the last slot in the range.
+     * @param function The function, taking the slot index and a reference to the slot.
+     */
+    template <typename TFUNCTION>
+    void ForEachInRange(const std::size_t first, const std::size_t last,
+                        TFUNCTION &&function) const;
+
+    /**
+     * @brief Get the number of occupied slots.
+     *
+     * @return The number of occupied slots.
+     */
+    auto Size() const noexcept;
+
+    /**
+     * @brief Get the number of allocated pages, including those on the free list.
+     *
+     * @return The number of allocated pages.
+     */
+    auto PageCount() const noexcept;
+
+    /**
+     * @brief Get the bytes held by the allocated pages and the page tables.
+     *
+     * @return The bytes.
+     */
+    auto MemoryBytes() const noexcept;
+
+private:
+    /**
+     * @brief Page struct, holding a fixed number of slots.
+     */
+    struct Page
+    {
+        std::array<T, PAGE_SIZE> m_slots;  ///< The slots.
+        std::size_t m_nOccupied;           ///< The number of occupied slots.
+    };
+
+    using Page_uPtr = std::unique_ptr<Page>;  ///< Alias for a unique pointer to a page.
+
+    static constexpr auto MAX_FREE_PAGES = SIZE_T(4UL);  ///< The most pages kept for reuse.
+
+    std::vector<Page_uPtr> m_pages;      ///< The page table, indexed by slot index / page size.
+    std::vector<Page_uPtr> m_freePages;  ///< Empty pages kept for reuse.
+    std::size_t m_nOccupied = 0UL;       ///< The number of occupied slots.
+};
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, std::size_t PAGE_SIZE>
+inline T *PagedSlotVector<T, PAGE_SIZE>::Find(const std::size_t index) noexcept
+{
+    return const_cast<T *>(static_cast<const PagedSlotVector &>(*this).Find(index));
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, std::size_t PAGE_SIZE>
+inline const T *PagedSlotVector<T, PAGE_SIZE>::Find(const std::size_t index) const noexcept
+{
+    const auto pageIndex = index / PAGE_SIZE;
+    if (pageIndex >= m_pages.size() || !m_pages[pageIndex]) return nullptr;
+
+    const auto &slot = m_pages[pageIndex]->m_slots[index % PAGE_SIZE];
+    return slot ? &slot : nullptr;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, std::size_t PAGE_SIZE>
+T &PagedSlotVector<T, PAGE_SIZE>::Emplace(const std::size_t index, T value)
+{
+    const auto pageIndex = index / PAGE_SIZE;
+    if (pageIndex >= m_pages.size()) m_pages.resize(pageIndex + SIZE_T(1UL));
+
+    auto &upPage = m_pages[pageIndex];
+
+    if (!upPage)
+    {
+        if (m_freePages.empty())
+            upPage = std::make_unique<Page>();
+
+        else
+        {
+            upPage = std::move(m_freePages.back());
+            m_freePages.pop_back();
+        }
+    }
+
+    auto &slot = upPage->m_slots[index % PAGE_SIZE];
+    KL_ASSERT(!slot, "Failed to fill slot that was already occupied");
+
+    slot = std::move(value);
+    ++upPage->m_nOccupied;
+    ++m_nOccupied;
+    return slot;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, std::size_t PAGE_SIZE>
+T PagedSlotVector<T, PAGE_SIZE>::Erase(const std::size_t index) noexcept
+{
+    const auto pageIndex = index / PAGE_SIZE;
+    if (pageIndex >= m_pages.size() || !m_pages[pageIndex]) return T{};
+
+    auto &upPage = m_pages[pageIndex];
+    auto &slot = upPage->m_slots[index % PAGE_SIZE];
+    if (!slot) return T{};
+
+    auto value = std::move(slot);
+    slot = T{};
+    --m_nOccupied;
+
+    // Keep a few empty pages for reuse and release the rest.
+    if (--upPage->m_nOccupied == SIZE_T(0UL))
+    {
+        if (m_freePages.size() < MAX_FREE_PAGES)
+        {
+            try
+            {
+                m_freePages.push_back(std::move(upPage));
+            }
+
+            catch (...)
+            {
+            }
+        }
+
+        upPage.reset();
+    }
+
+    return value;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, std::size_t PAGE_SIZE>
+inline void PagedSlotVector<T, PAGE_SIZE>::Clear() noexcept
+{
+    m_pages.clear();
+    m_freePages.clear();
+    m_nOccupied = SIZE_T(0UL);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, std::size_t PAGE_SIZE>
+inline void PagedSlotVector<T, PAGE_SIZE>::Reserve(const std::size_t size)
+{
+    m_pages.reserve((size + PAGE_SIZE - SIZE_T(1UL)) / PAGE_SIZE);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, std::size_t PAGE_SIZE>
+template <typename TFUNCTION>
+void PagedSlotVector<T, PAGE_SIZE>::ForEach(TFUNCTION &&function) const
+{
+    for (auto pageIndex = SIZE_T(0UL); pageIndex < m_pages.size(); ++pageIndex)
+    {
+        const auto &upPage = m_pages[pageIndex];
+        if (!upPage) continue;
+
+        for (auto slotIndex = SIZE_T(0UL); slotIndex < PAGE_SIZE; ++slotIndex)
+        {
+            const auto &slot = upPage->m_slots[slotIndex];
+            if (slot) function(pageIndex * PAGE_SIZE + slotIndex, slot);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, std::size_t PAGE_SIZE>
+template <typename TFUNCTION>
+void PagedSlotVector<T, PAGE_SIZE>::ForEachInRange(const std::size_t first, const std::size_t last,
+                                                   TFUNCTION &&function) const
+{
+    if (first > last) return;
+
+    const auto lastPageIndex = last / PAGE_SIZE;
+
+    for (auto pageIndex = first / PAGE_SIZE;
+         (pageIndex < m_pages.size()) && (pageIndex <= lastPageIndex); ++pageIndex)
+    {
+        const auto &upPage = m_pages[pageIndex];
+        if (!upPage) continue;
+
+        // The range may end at the largest index, so the end of the range is not computed.
+        const auto pageBegin = pageIndex * PAGE_SIZE;
+        const auto firstSlotIndex = std::max(first, pageBegin) - pageBegin;
+        const auto lastSlotIndex = std::min(last - pageBegin, PAGE_SIZE - SIZE_T(1UL));
+
+        for (auto slotIndex = firstSlotIndex; slotIndex <= lastSlotIndex; ++slotIndex)
+        {
+            const auto &slot = upPage->m_slots[slotIndex];
+            if (slot) function(pageBegin + slotIndex, slot);
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, std::size_t PAGE_SIZE>
+inline auto PagedSlotVector<T, PAGE_SIZE>::Size() const noexcept
+{
+    return m_nOccupied;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, std::size_t PAGE_SIZE>
+inline auto PagedSlotVector<T, PAGE_SIZE>::PageCount() const noexcept
+{
+    const auto nPages =
+        std::count_if(m_pages.cbegin(), m_pages.cend(),
+                      [](const Page_uPtr &upPage) { return static_cast<bool>(upPage); });
+
+    return static_cast<std::size_t>(nPages) + m_freePages.size();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T, std::size_t PAGE_SIZE>
+inline auto PagedSlotVector<T, PAGE_SIZE>::MemoryBytes() const noexcept
+{
+    return this->PageCount() * sizeof(Page) +
+           (m_pages.capacity() + m_freePages.capacity()) * sizeof(Page_uPtr);
+}
+}  // namespace kl
+
+#endif  // #ifndef KL_PAGED_SLOT_VECTOR_H
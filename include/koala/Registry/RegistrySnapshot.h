@@ -0,0 +1,138 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/include/koala/Registry/RegistrySnapshot.h
+ *
+ * @brief Header file for the registry snapshot (RegistrySnapshot) class template.
+ */
+
+#ifndef KL_REGISTRY_SNAPSHOT_H
+#define KL_REGISTRY_SNAPSHOT_H 1
+
+#include "koala/Definitions.h"
+#include "koala/Registry/TypeTag.h"
+
+#include <memory>
+#include <typeindex>
+
+namespace kl
+{
+/**
+ * @brief Forward declaration of the ObjectRegistry class template.
+ */
+template <typename TBASE, typename TALIAS>
+class ObjectRegistry;
+
+/**
+ * @brief RegistrySnapshot class template. An immutable view of the contents of a registry at the
+ * moment it was taken, which is read without any locking: the registry can be written to freely
+ * while the snapshot is in use, and the objects in the snapshot are kept alive until it is
+ * released, even if they are deleted from the registry. The objects themselves are shared with the
+ * registry, not copied.
+ */
+template <typename TBASE, typename TALIAS>
+class RegistrySnapshot
+{
+private:
+    using TBASE_D = std::decay_t<TBASE>;             ///< Alias for decayed TBASE type.
+    using Registry = ObjectRegistry<TBASE, TALIAS>;  ///< Alias for the registry type.
+    using Registry_cPtr =
+        std::shared_ptr<const Registry>;  ///< Alias for a shared pointer to a const registry.
+    using Snapshot_cPtr =
+        typename Registry::Snapshot_cPtr;  ///< Alias for a shared pointer to the snapshot data.
+
+    friend Registry;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param spRegistry Shared pointer to the registry.
+     * @param spSnapshot Shared pointer to the snapshot data.
+     */
+    RegistrySnapshot(Registry_cPtr spRegistry, Snapshot_cPtr spSnapshot) noexcept;
+
+public:
+    /**
+     * @brief Default copy constructor.
+     */
+    RegistrySnapshot(const RegistrySnapshot &) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    RegistrySnapshot(RegistrySnapshot &&) = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    RegistrySnapshot &operator=(const RegistrySnapshot &) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    RegistrySnapshot &operator=(RegistrySnapshot &&) = default;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~RegistrySnapshot() = default;
+
+    /**
+     * @brief Get an object in the snapshot by ID or by alias.
+     *
+     * @param arg The ID or the alias of the object.
+     *
+     * @return The object.
+     */
+    template <typename TOBJECT = TBASE_D, typename T>
+    const auto &Get(T &&arg) const;
+
+    /**
+     * @brief Find out whether an object of a given type with a given ID is in the snapshot.
+     *
+     * @param objectId The ID of the object.
+     *
+     * @return Whether the object is in the snapshot.
+     */
+    template <typename TDESIRED = TBASE_D>
+    auto DoesObjectExist(const ID_t objectId) const noexcept;
+
+    /**
+     * @brief Call a function on every object of a given type in the snapshot.
+     *
+     * @param function The function, taking a const reference to the object.
+     */
+    template <typename TOBJECT = TBASE_D, typename TFUNCTION>
+    void ForEach(TFUNCTION &&function) const;
+
+    /**
+     * @brief Get the number of objects of a given type in the snapshot.
+     *
+     * @return The number of objects.
+     */
+    template <typename TOBJECT = TBASE_D>
+    auto Count() const noexcept;
+
+    /**
+     * @brief Get the number of objects in the snapshot.
+     *
+     * @return The number of objects.
+     */
+    auto CountAll() const noexcept;
+
+private:
+    Registry_cPtr m_spRegistry;  ///< Shared pointer to the registry.
+    Snapshot_cPtr m_spSnapshot;  ///< Shared pointer to the snapshot data.
+};
+}  // namespace kl
+
+//--------------------------------------------------------------------------------------------------
+
+#include "koala/Registry/RegistrySnapshot.txx"
+
+#endif  // #ifndef KL_REGISTRY_SNAPSHOT_H
@@ -0,0 +1,116 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/include/koala/Registry/RegistrySnapshot.txx
+ *
+ * @brief Template implementation header file for the registry snapshot (RegistrySnapshot) class
+ * template.
+ */
+
+#ifndef KL_REGISTRY_SNAPSHOT_IMPL_H
+#define KL_REGISTRY_SNAPSHOT_IMPL_H 1
+
+namespace kl
+{
+template <typename TBASE, typename TALIAS>
+RegistrySnapshot<TBASE, TALIAS>::RegistrySnapshot(Registry_cPtr spRegistry,
+                                                  Snapshot_cPtr spSnapshot) noexcept
+    : m_spRegistry{std::move(spRegistry)}, m_spSnapshot{std::move(spSnapshot)}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT, typename T>
+inline const auto &RegistrySnapshot<TBASE, TALIAS>::Get(T &&arg) const
+{
+    const auto slot = [&]() {
+        if constexpr (std::is_integral<std::decay_t<T>>::value)
+            return m_spRegistry->GetSlot(m_spSnapshot.get(), static_cast<ID_t>(arg));
+        else
+            return m_spRegistry->GetSlot(m_spSnapshot.get(), std::forward<T>(arg));
+    }();
+
+    // The snapshot holds the object, so the reference stays valid for as long as the snapshot.
+    if (const auto pCastObject =
+            Registry::template CastObjectPointer<TOBJECT>(slot.m_spObject.get(), slot.m_typeTag))
+        return static_cast<const std::decay_t<TOBJECT> &>(*pCastObject);
+
+    KL_THROW("The registry snapshot could not dynamically cast the called "
+             << KL_WHITE_BOLD << m_spRegistry->PrintableBaseName() << KL_NORMAL << " object "
+             << "into the desired type");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TDESIRED>
+inline auto RegistrySnapshot<TBASE, TALIAS>::DoesObjectExist(const ID_t objectId) const noexcept
+{
+    const auto slot = m_spRegistry->FindSlot(m_spSnapshot.get(), objectId);
+    return (Registry::template CastObjectPointer<TDESIRED>(slot.m_spObject.get(),
+                                                           slot.m_typeTag) != nullptr);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT, typename TFUNCTION>
+void RegistrySnapshot<TBASE, TALIAS>::ForEach(TFUNCTION &&function) const
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    for (const auto &typeMapElement : m_spSnapshot->m_objectTypeMap)
+    {
+        const auto &bucket = typeMapElement.second;
+        if (bucket.empty() || !IsKindOf<TOBJECT_D>(typeMapElement.first, *bucket.front())) continue;
+
+        // Only a bucket of exactly the requested type can be cast statically.
+        const auto typeTag = (typeMapElement.first == std::type_index{typeid(TOBJECT_D)})
+                                 ? GetTypeTag<TOBJECT_D>()
+                                 : UNKNOWN_TYPE_TAG;
+
+        for (const auto pObject : bucket)
+        {
+            function(static_cast<const TOBJECT_D &>(
+                *Registry::template CastObjectPointer<TOBJECT_D>(pObject, typeTag)));
+        }
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+auto RegistrySnapshot<TBASE, TALIAS>::Count() const noexcept
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+    auto count = SIZE_T(0UL);
+
+    for (const auto &typeMapElement : m_spSnapshot->m_objectTypeMap)
+    {
+        const auto &bucket = typeMapElement.second;
+
+        if (!bucket.empty() && IsKindOf<TOBJECT_D>(typeMapElement.first, *bucket.front()))
+            count += bucket.size();
+    }
+
+    return count;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+inline auto RegistrySnapshot<TBASE, TALIAS>::CountAll() const noexcept
+{
+    return m_spSnapshot->m_objectSlots.Size();
+}
+}  // namespace kl
+
+#endif  // #ifndef KL_REGISTRY_SNAPSHOT_IMPL_H
@@ -0,0 +1,189 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/include/koala/Registry/TypeTag.h
+ *
+ * @brief Header file for the compact integer tags identifying registered object types, and the
+ * cached subtype relations between them.
+ */
+
+#ifndef KL_TYPE_TAG_H
+#define KL_TYPE_TAG_H 1
+
+#include "koala/Definitions.h"
+#include "koala/Lock.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace kl
+{
+using TypeTag = std::uint32_t;  ///< Alias for a type tag.
+
+constexpr auto UNKNOWN_TYPE_TAG = TypeTag{0U};  ///< The tag of no type.
+
+/**
+ * @brief Get the tag of the type with a given (mangled) name, assigning the next tag on first use.
+ * Tags are only meaningful within the running process.
+ *
+ * @param typeName The name of the type.
+ *
+ * @return The type tag.
+ */
+TypeTag GetTypeTag(const std::string &typeName);
+
+/**
+ * @brief Get the tag of a given type.
+ *
+ * @return The type tag.
+ */
+template <typename T>
+TypeTag GetTypeTag();
+
+/**
+ * @brief Get the (mangled) name of the type with a given tag, e.g. for saving containers keyed on
+ * tags.
+ *
+ * @param typeTag The type tag.
+ *
+ * @return The name of the type.
+ */
+std::string GetTypeName(const TypeTag typeTag);
+
+/**
+ * @brief TypeTagTable struct, holding the tags assigned so far and the names of their types.
+ */
+struct TypeTagTable
+{
+    std::mutex m_mutex;                                    ///< The mutex for the table.
+    std::unordered_map<std::string, TypeTag> m_typeTags;  ///< The tags by type name.
+    std::vector<std::string> m_typeNames;                  ///< The type names, by tag less one.
+
+    /**
+     * @brief Get the table shared by every type.
+     *
+     * @return The table.
+     */
+    static TypeTagTable &Instance();
+};
+
+/**
+ * @brief Find out whether the objects of a given concrete type are of a given kind (i.e. are
+ * instances of the type or of one of its subclasses). The answer is worked out from an exemplar the
+ * first time the concrete type is asked about, and cached for every later query.
+ *
+ * @param typeIndex The concrete type of the exemplar.
+ * @param exemplar An object whose dynamic type is the concrete type.
+ *
+ * @return Whether objects of the concrete type are of the kind.
+ */
+template <typename TKIND, typename TEXEMPLAR>
+bool IsKindOf(const std::type_index &typeIndex, const TEXEMPLAR &exemplar);
+
+/**
+ * @brief IsStaticallyCastable class template. Whether a pointer to one type may be static-cast to a
+ * pointer to another (e.g. not when downcasting through a virtual base).
+ */
+template <typename TFROM, typename TTO, typename = void>
+struct IsStaticallyCastable : std::false_type
+{
+};
+
+/**
+ * @brief IsStaticallyCastable class template specialization for castable types.
+ */
+template <typename TFROM, typename TTO>
+struct IsStaticallyCastable<TFROM, TTO,
+                            std::void_t<decltype(static_cast<TTO *>(std::declval<TFROM *>()))>>
+    : std::true_type
+{
+};
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+inline TypeTag GetTypeTag(const std::string &typeName)
+{
+    auto &typeTagTable = TypeTagTable::Instance();
+    const auto lock = std::lock_guard<std::mutex>{typeTagTable.m_mutex};
+
+    const auto nextTypeTag = static_cast<TypeTag>(typeTagTable.m_typeNames.size() + SIZE_T(1UL));
+    const auto emplaceResult = typeTagTable.m_typeTags.emplace(typeName, nextTypeTag);
+    if (emplaceResult.second) typeTagTable.m_typeNames.push_back(typeName);
+
+    return emplaceResult.first->second;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline TypeTag GetTypeTag()
+{
+    static const auto typeTag = GetTypeTag(typeid(std::decay_t<T>).name());
+    return typeTag;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline std::string GetTypeName(const TypeTag typeTag)
+{
+    auto &typeTagTable = TypeTagTable::Instance();
+    const auto lock = std::lock_guard<std::mutex>{typeTagTable.m_mutex};
+
+    if ((typeTag == UNKNOWN_TYPE_TAG) || (typeTag > typeTagTable.m_typeNames.size()))
+        KL_THROW("Could not get the name of the type with tag " << typeTag);
+
+    return typeTagTable.m_typeNames[typeTag - TypeTag{1U}];
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline TypeTagTable &TypeTagTable::Instance()
+{
+    static auto typeTagTable = TypeTagTable{};
+    return typeTagTable;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TKIND, typename TEXEMPLAR>
+bool IsKindOf(const std::type_index &typeIndex, const TEXEMPLAR &exemplar)
+{
+    using TKIND_D = std::decay_t<TKIND>;
+
+    if constexpr (std::is_base_of<TKIND_D, TEXEMPLAR>::value)
+    {
+        static_cast<void>(typeIndex);
+        static_cast<void>(exemplar);
+        return true;
+    }
+
+    else
+    {
+        static auto mutex = Mutex{};
+        static auto isKindMap = std::unordered_map<std::type_index, bool>{};
+
+        {
+            const auto lock = ReadLock{mutex};
+            const auto findIter = isKindMap.find(typeIndex);
+            if (findIter != isKindMap.cend()) return findIter->second;
+        }
+
+        const auto isKind = (dynamic_cast<const TKIND_D *>(&exemplar) != nullptr);
+        const auto lock = WriteLock{mutex};
+        return isKindMap.emplace(typeIndex, isKind).first->second;
+    }
+}
+}  // namespace kl
+
+#endif  // #ifndef KL_TYPE_TAG_H
@@ -0,0 +1,246 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/include/koala/Registry/WorkerPool.h
+ *
+ * @brief Header file for the persistent worker pool (WorkerPool) class.
+ */
+
+#ifndef KL_WORKER_POOL_H
+#define KL_WORKER_POOL_H 1
+
+#include "koala/Definitions.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace kl
+{
+/**
+ * @brief WorkerPool class. A process-wide set of threads, started on first use and kept until
+ * exit, that help a calling thread run a task. The task is shared rather than split: the caller
+ * and every helper run the same task, which must divide its work among them (e.g. by claiming
+ * chunks from an atomic counter). Helpers that have not started by the time the caller finishes
+ * the task are skipped, so a task that runs a pool task of its own never waits on a busy pool.
+ */
+class WorkerPool
+{
+public:
+    static constexpr auto MAX_THREADS = SIZE_T(256UL);  ///< The most threads ever started.
+
+    /**
+     * @brief Deleted copy constructor.
+     */
+    WorkerPool(const WorkerPool &) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    WorkerPool(WorkerPool &&) = delete;
+
+    /**
+     * @brief Deleted copy assignment operator.
+     */
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    /**
+     * @brief Deleted move assignment operator.
+     */
+    WorkerPool &operator=(WorkerPool &&) = delete;
+
+    /**
+     * @brief Destructor, stopping and joining the threads.
+     */
+    ~WorkerPool();
+
+    /**
+     * @brief Get the process-wide pool.
+     *
+     * @return The pool.
+     */
+    static WorkerPool &Get();
+
+    /**
+     * @brief Run a task on the calling thread and on up to a number of helper threads, returning
+     * once the caller and every helper that started have finished it.
+     *
+     * @param nWorkers The number of threads, including the calling thread.
+     * @param task The task, which must not throw (called concurrently).
+     */
+    void Run(const std::size_t nWorkers, const std::function<void()> &task);
+
+    /**
+     * @brief Get the number of threads started so far.
+     *
+     * @return The number of threads.
+     */
+    auto ThreadCount() const;
+
+private:
+    /**
+     * @brief Job struct, tracking the helpers running one task.
+     */
+    struct Job
+    {
+        std::mutex m_mutex;                   ///< The mutex guarding the job.
+        std::condition_variable m_condition;  ///< Signalled when a helper finishes.
+        std::size_t m_nRunning = 0UL;         ///< The number of helpers running the task.
+        bool m_isClosed = false;              ///< Whether helpers may no longer start.
+    };
+
+    /**
+     * @brief Default constructor.
+     */
+    WorkerPool() = default;
+
+    /**
+     * @brief Start threads until there are a given number, or as many as can be started.
+     *
+     * @param nThreads The number of threads.
+     */
+    void Grow(const std::size_t nThreads);
+
+    /**
+     * @brief The loop run by each thread, taking queued helpers until the pool stops.
+     */
+    void Work();
+
+    mutable std::mutex m_mutex;                   ///< The mutex guarding the queue and threads.
+    std::condition_variable m_condition;          ///< Signalled when a helper is queued.
+    std::deque<std::function<void()>> m_helpers;  ///< The queued helpers.
+    std::vector<std::thread> m_threads;           ///< The threads.
+    bool m_isStopping = false;                    ///< Whether the threads must exit.
+};
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+inline WorkerPool::~WorkerPool()
+{
+    {
+        const auto lock = std::lock_guard<std::mutex>{m_mutex};
+        m_isStopping = true;
+    }
+
+    m_condition.notify_all();
+    for (auto &thread : m_threads) thread.join();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline WorkerPool &WorkerPool::Get()
+{
+    static WorkerPool workerPool;
+    return workerPool;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void WorkerPool::Run(const std::size_t nWorkers, const std::function<void()> &task)
+{
+    if (nWorkers <= SIZE_T(1UL))
+    {
+        task();
+        return;
+    }
+
+    const auto nHelpers = std::min(nWorkers - SIZE_T(1UL), MAX_THREADS);
+
+    const auto spJob = std::make_shared<Job>();
+
+    // A helper only touches the task once it has registered as running, which the caller waits
+    // for, so the task may live on the caller's stack.
+    const auto helper = [spJob, pTask = &task]() {
+        {
+            const auto jobLock = std::lock_guard<std::mutex>{spJob->m_mutex};
+            if (spJob->m_isClosed) return;
+
+            ++spJob->m_nRunning;
+        }
+
+        (*pTask)();
+
+        {
+            const auto jobLock = std::lock_guard<std::mutex>{spJob->m_mutex};
+            --spJob->m_nRunning;
+        }
+
+        spJob->m_condition.notify_all();
+    };
+
+    {
+        const auto lock = std::lock_guard<std::mutex>{m_mutex};
+        this->Grow(nHelpers);
+
+        // Queue no more helpers than there are threads to take them.
+        const auto nQueued = std::min(nHelpers, m_threads.size());
+
+        for (auto helperIndex = SIZE_T(0UL); helperIndex < nQueued; ++helperIndex)
+            m_helpers.emplace_back(helper);
+    }
+
+    m_condition.notify_all();
+    task();
+
+    auto jobLock = std::unique_lock<std::mutex>{spJob->m_mutex};
+    spJob->m_isClosed = true;
+    spJob->m_condition.wait(jobLock, [&spJob]() { return spJob->m_nRunning == SIZE_T(0UL); });
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline auto WorkerPool::ThreadCount() const
+{
+    const auto lock = std::lock_guard<std::mutex>{m_mutex};
+    return m_threads.size();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void WorkerPool::Grow(const std::size_t nThreads)
+{
+    try
+    {
+        while (m_threads.size() < nThreads) m_threads.emplace_back([this]() { this->Work(); });
+    }
+    catch (const std::system_error &)
+    {
+        // Could not start another thread: make do with those already running.
+    }
+}
+
+//--------------------------------------------------------------------------------------------------
+
+inline void WorkerPool::Work()
+{
+    while (true)
+    {
+        auto helper = std::function<void()>{};
+
+        {
+            auto lock = std::unique_lock<std::mutex>{m_mutex};
+            m_condition.wait(lock, [this]() { return m_isStopping || !m_helpers.empty(); });
+            if (m_isStopping) return;
+
+            helper = std::move(m_helpers.front());
+            m_helpers.pop_front();
+        }
+
+        helper();
+    }
+}
+}  // namespace kl
+
+#endif  // #ifndef KL_WORKER_POOL_H
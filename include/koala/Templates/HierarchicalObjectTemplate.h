@@ -113,12 +113,13 @@ public:
     /**
      * @brief Subsume an object into this object.
      *
-     * @param arg The contained object, contained object alias or contained object ID.
+     * @param arg The contained object, alias, ID or handle.
      */
     template <typename T,
               typename = std::enable_if_t<std::is_same<TALIAS_D, std::decay_t<T>>::value ||
                                           std::is_base_of<TBASE_D, std::decay_t<T>>::value ||
-                                          std::is_same<ID_t, std::decay_t<T>>::value>>
+                                          std::is_same<ID_t, std::decay_t<T>>::value ||
+                                          IsHandle<std::decay_t<T>>::value>>
     void Subsume(T &&arg);
 
     /**
@@ -142,12 +143,13 @@ public:
     /**
      * @brief Find out whether this object encloses another object.
      *
-     * @param arg The object, object alias or object ID.
+     * @param arg The object, object alias, object ID or object handle.
      */
     template <typename T,
               typename = std::enable_if_t<std::is_same<TALIAS_D, std::decay_t<T>>::value ||
                                           std::is_base_of<TBASE_D, std::decay_t<T>>::value ||
-                                          std::is_same<ID_t, std::decay_t<T>>::value>>
+                                          std::is_same<ID_t, std::decay_t<T>>::value ||
+                                          IsHandle<std::decay_t<T>>::value>>
     auto Encloses(T &&arg) const;
 
     //----------------------------------------------------------------------------------------------
@@ -176,7 +178,7 @@ public:
     /**
      * @brief Add a new daughter edge.
      *
-     * @param arg The daughter, daughter alias or daughter ID.
+     * @param arg The daughter, daughter alias, daughter ID or daughter handle.
      * @param args The arguments to pass to the edge constructor.
      *
      * @return The new edge.
@@ -185,7 +187,8 @@ public:
               typename = std::enable_if_t<
                   (std::is_same<TALIAS_D, std::decay_t<T>>::value ||
                    std::is_base_of<TBASE_D, std::decay_t<T>>::value ||
-                   std::is_same<ID_t, std::decay_t<T>>::value) &&
+                   std::is_same<ID_t, std::decay_t<T>>::value ||
+                   IsHandle<std::decay_t<T>>::value) &&
                   (std::is_base_of<HierarchicalEdge<std::decay_t<TEDGE>, TBASE_D, true>,
                                    std::decay_t<TEDGE>>::value ||
                    std::is_base_of<HierarchicalEdge<std::decay_t<TEDGE>, TBASE_D, false>,
@@ -218,7 +221,7 @@ public:
     /**
      * @brief Add a new parent edge.
      *
-     * @param arg The parent, parent alias or parent ID.
+     * @param arg The parent, parent alias, parent ID or parent handle.
      * @param args The arguments to pass to the edge constructor.
      *
      * @return The new edge.
@@ -227,13 +230,22 @@ public:
               typename = std::enable_if_t<
                   (std::is_same<TALIAS_D, std::decay_t<T>>::value ||
                    std::is_base_of<TBASE_D, std::decay_t<T>>::value ||
-                   std::is_same<ID_t, std::decay_t<T>>::value) &&
+                   std::is_same<ID_t, std::decay_t<T>>::value ||
+                   IsHandle<std::decay_t<T>>::value) &&
                   (std::is_base_of<HierarchicalEdge<std::decay_t<TEDGE>, TBASE_D, true>,
                                    std::decay_t<TEDGE>>::value ||
                    std::is_base_of<HierarchicalEdge<std::decay_t<TEDGE>, TBASE_D, false>,
                                    std::decay_t<TEDGE>>::value)>>
     auto &AddParentEdge(T &&arg, TARGS &&... args);
 
+    /**
+     * @brief Estimate the memory held by this object beyond its own payload: its association
+     * tables, its hierarchy sets, the edges of which it is the parent and its mutexes.
+     *
+     * @return The memory report.
+     */
+    auto MemoryUsage() const;
+
 protected:
     using Koala_wPtr = typename RegisteredObject::Koala_wPtr;  ///< Alias for a weak pointer to
                                                                ///< the instance of Koala.
@@ -672,14 +684,15 @@ private:
     /**
      * @brief Get a shared pointer to a member.
      *
-     * @param arg The member, member alias or member ID.
+     * @param arg The member, member alias, member ID or member handle.
      *
      * @return The shared pointer.
      */
     template <typename T,
               typename = std::enable_if_t<std::is_same<TALIAS_D, std::decay_t<T>>::value ||
                                           std::is_base_of<TBASE_D, std::decay_t<T>>::value ||
-                                          std::is_same<ID_t, std::decay_t<T>>::value>>
+                                          std::is_same<ID_t, std::decay_t<T>>::value ||
+                                          IsHandle<std::decay_t<T>>::value>>
     auto GetSharedPointerToMember(T &&arg) const;
 
     /**
@@ -181,13 +181,11 @@ inline auto HierarchicalObjectTemplate<TBASE, TALIAS>::Contained() const
     const auto regLock = ReadLock{this->GetRegistry().Mutex()};
 
     using TOBJECT_D = std::decay_t<TOBJECT>;
-    return RangeBasedContainer<TBASE_wPtrSet, TBASE_D, TOBJECT_D, TOBJECT_D>{
+    return MakeRangeBasedContainer<TBASE_wPtrSet, TBASE_D, TOBJECT_D, TOBJECT_D>(
         [](const TBASE_wPtr &) { return true; },
         [](const TBASE_wPtr &wpBase) { return wpBase.lock(); },
-        [](const std::shared_ptr<TOBJECT_D> &spObject) -> auto &{return *spObject;
-}
-, ReadLock{m_mutexContained}, ReadLock{this->GetRegistry().Mutex()}, m_contained
-};  // namespace kl
+        [](const std::shared_ptr<TOBJECT_D> &spObject) -> auto & { return *spObject; },
+        ReadLock{m_mutexContained}, ReadLock{this->GetRegistry().Mutex()}, m_contained);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -289,17 +287,16 @@ inline auto HierarchicalObjectTemplate<TBASE, TALIAS>::Daughters() const
 
     using TOBJECT_D = std::decay_t<TOBJECT>;
 
-    return RangeBasedContainer<PseudoEdgeBase_wPtrSet, PseudoEdgeBase, PseudoEdgeBase, TOBJECT_D>{
+    return MakeRangeBasedContainer<PseudoEdgeBase_wPtrSet, PseudoEdgeBase, PseudoEdgeBase,
+                                   TOBJECT_D>(
         [](const PseudoEdgeBase_wPtr &wpPseudoEdge) {
             return wpPseudoEdge.lock()->template ObjectIsA<TOBJECT_D>();
         },
         [](const PseudoEdgeBase_wPtr &wpPseudoEdge) { return wpPseudoEdge.lock(); },
-        [](const PseudoEdgeBase_sPtr &spEdge) -> auto &{
-                                                  return spEdge->template GetObject<TOBJECT_D>();
-}
-, ReadLock{m_mutexDaughters}, ReadLock{this->GetRegistry().Mutex()}, m_daughterEdges
-}
-;
+        [](const PseudoEdgeBase_sPtr &spEdge) -> auto & {
+            return spEdge->template GetObject<TOBJECT_D>();
+        },
+        ReadLock{m_mutexDaughters}, ReadLock{this->GetRegistry().Mutex()}, m_daughterEdges);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -313,18 +310,16 @@ inline auto HierarchicalObjectTemplate<TBASE, TALIAS>::DaughterEdges() const
     const auto lock = ReadLock{m_mutexDaughters};
     const auto regLock = ReadLock{this->GetRegistry().Mutex()};
 
-    return RangeBasedContainer<PseudoEdgeBase_wPtrSet, PseudoEdgeBase, TPSEUDOEDGE, TPSEUDOEDGE>{
+    return MakeRangeBasedContainer<PseudoEdgeBase_wPtrSet, PseudoEdgeBase, TPSEUDOEDGE,
+                                   TPSEUDOEDGE>(
         [](const PseudoEdgeBase_wPtr &wpPseudoEdge) {
             return static_cast<bool>(std::dynamic_pointer_cast<TPSEUDOEDGE>(wpPseudoEdge.lock()));
         },
         [](const PseudoEdgeBase_wPtr &wpPseudoEdge) {
             return std::dynamic_pointer_cast<TPSEUDOEDGE>(wpPseudoEdge.lock());
         },
-        [](const typename TPSEUDOEDGE::sPtr &spEdge) -> auto &{return *spEdge;
-}
-, ReadLock{m_mutexDaughters}, ReadLock{this->GetRegistry().Mutex()}, m_daughterEdges
-}
-;
+        [](const typename TPSEUDOEDGE::sPtr &spEdge) -> auto & { return *spEdge; },
+        ReadLock{m_mutexDaughters}, ReadLock{this->GetRegistry().Mutex()}, m_daughterEdges);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -353,17 +348,16 @@ inline auto HierarchicalObjectTemplate<TBASE, TALIAS>::Parents() const
 
     using TOBJECT_D = std::decay_t<TOBJECT>;
 
-    return RangeBasedContainer<PseudoEdgeBase_wPtrSet, PseudoEdgeBase, PseudoEdgeBase, TOBJECT_D>{
+    return MakeRangeBasedContainer<PseudoEdgeBase_wPtrSet, PseudoEdgeBase, PseudoEdgeBase,
+                                   TOBJECT_D>(
         [](const PseudoEdgeBase_wPtr &wpPseudoEdge) {
             return wpPseudoEdge.lock()->template ObjectIsA<TOBJECT_D>();
         },
         [](const PseudoEdgeBase_wPtr &wpPseudoEdge) { return wpPseudoEdge.lock(); },
-        [](const PseudoEdgeBase_sPtr &spEdge) -> auto &{
-                                                  return spEdge->template GetObject<TOBJECT_D>();
-}
-, ReadLock{m_mutexParents}, ReadLock{this->GetRegistry().Mutex()}, m_parentEdges
-}
-;
+        [](const PseudoEdgeBase_sPtr &spEdge) -> auto & {
+            return spEdge->template GetObject<TOBJECT_D>();
+        },
+        ReadLock{m_mutexParents}, ReadLock{this->GetRegistry().Mutex()}, m_parentEdges);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -377,18 +371,16 @@ inline auto HierarchicalObjectTemplate<TBASE, TALIAS>::ParentEdges() const
     const auto lock = ReadLock{m_mutexParents};
     const auto regLock = ReadLock{this->GetRegistry().Mutex()};
 
-    return RangeBasedContainer<PseudoEdgeBase_wPtrSet, PseudoEdgeBase, TPSEUDOEDGE, TPSEUDOEDGE>{
+    return MakeRangeBasedContainer<PseudoEdgeBase_wPtrSet, PseudoEdgeBase, TPSEUDOEDGE,
+                                   TPSEUDOEDGE>(
         [](const PseudoEdgeBase_wPtr &wpPseudoEdge) {
             return static_cast<bool>(std::dynamic_pointer_cast<TPSEUDOEDGE>(wpPseudoEdge.lock()));
         },
         [](const PseudoEdgeBase_wPtr &wpPseudoEdge) {
             return std::dynamic_pointer_cast<TPSEUDOEDGE>(wpPseudoEdge.lock());
         },
-        [](const typename TPSEUDOEDGE::sPtr &spEdge) -> auto &{return *spEdge;
-}
-, ReadLock{m_mutexParents}, ReadLock{this->GetRegistry().Mutex()}, m_parentEdges
-}
-;
+        [](const typename TPSEUDOEDGE::sPtr &spEdge) -> auto & { return *spEdge; },
+        ReadLock{m_mutexParents}, ReadLock{this->GetRegistry().Mutex()}, m_parentEdges);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -1134,6 +1126,43 @@ inline auto HierarchicalObjectTemplate<TBASE, TALIAS>::GetWeakPointer() const
 
 //--------------------------------------------------------------------------------------------------
 
+template <typename TBASE, typename TALIAS>
+auto HierarchicalObjectTemplate<TBASE, TALIAS>::MemoryUsage() const
+{
+    auto memoryReport = RegisteredObject::MemoryUsage();
+    memoryReport.m_mutexBytes += SIZE_T(4UL) * sizeof(Mutex);
+
+    const auto daughtersLock = ReadLock{m_mutexDaughters};
+    const auto parentsLock = ReadLock{m_mutexParents};
+    const auto containedLock = ReadLock{m_mutexContained};
+    const auto containingLock = ReadLock{m_mutexContaining};
+
+    memoryReport.m_edgeBytes +=
+        TreeContainerBytes(m_daughterEdges) + TreeContainerBytes(m_parentEdges) +
+        TreeContainerBytes(m_relatedDaughterEdges) + TreeContainerBytes(m_relatedParentEdges) +
+        TreeContainerBytes(m_contained) + TreeContainerBytes(m_containing) +
+        HashContainerBytes(m_edges);
+
+    // Both ends of an edge hold it, so only its parent counts it and its pseudo-edges.
+    const auto pThis = static_cast<const TBASE_D *>(this);
+
+    for (const Edge_sPtr &spEdge : m_edges)
+    {
+        if (spEdge->ParentWeakPointer().lock().get() != pThis) continue;
+
+        const auto edgeLock = ReadLock{spEdge->m_mutex};
+        const auto nPseudoEdges = spEdge->m_pseudoEdges.size();
+
+        memoryReport.m_edgeBytes += sizeof(Edge) + CONTROL_BLOCK_BYTES +
+                                    HashContainerBytes(spEdge->m_pseudoEdges) +
+                                    nPseudoEdges * (sizeof(PseudoEdgeBase) + CONTROL_BLOCK_BYTES);
+    }
+
+    return memoryReport;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 #ifdef KOALA_ENABLE_CEREAL
 template <typename TBASE, typename TALIAS>
 template <typename TARCHIVE>
@@ -16,8 +16,10 @@
 #define KL_REGISTERED_OBJECT_TEMPLATE_H
 
 #include "koala/Definitions.h"
+#include "koala/Registry/MemoryReport.h"
 #include "koala/Registry/ObjectAssociation.h"
 #include "koala/Registry/ObjectRegistry.h"
+#include "koala/Registry/TypeTag.h"
 
 #ifdef KOALA_ENABLE_CEREAL
 #include "cereal/access.hpp"
@@ -280,13 +282,37 @@ protected:
 #endif  // #ifdef KOALA_ENABLE_CEREAL
 
 private:
-    // using TypeInfoAssocMultiMap = std::unordered_multimap<TypeInfoRef,
-    // ObjectAssociationBase::sPtr, TypeInfoHashFunctor,
-    //                                                      TypeInfoCompareFunctor>; ///< Alias for
-    //                                                      typeinfo-assoc multimap.
     using TypeInfoAssocMultiMap =
-        std::unordered_multimap<std::string,
-                                ObjectAssociationBase::sPtr>;  ///< Alias for type-association map.
+        std::unordered_map<TypeTag,
+                           ObjectAssociationBase::sPtrSet>;  ///< Alias for type-association map.
+    using TypeNameAssocMultiMap = std::unordered_multimap<
+        std::string, ObjectAssociationBase::sPtr>;  ///< Alias for type-name-association map.
+    using AssociationDescriber = auto (*)(const RegisteredObjectTemplate &source,
+                                          const ID_t objectId, const bool isCerealSerializable,
+                                          const bool hasIndicator, std::string indicatorString)
+        -> AssociationInformation;  ///< Alias for a function describing an associated object.
+
+    /**
+     * @brief AssociationDescriberTable struct, holding the function describing the associated
+     * objects of each type with which objects of this base type have formed associations.
+     */
+    struct AssociationDescriberTable
+    {
+        Mutex m_mutex;  ///< The mutex for the table.
+        std::unordered_map<TypeTag, AssociationDescriber> m_describers;  ///< The describers by tag.
+    };
+
+    /**
+     * @brief AssociationRow struct, holding a copy of a row of the association table.
+     */
+    struct AssociationRow
+    {
+        ID_t m_targetId;                ///< The ID of the associated object.
+        TypeTag m_typeTag;              ///< The tag of the associated object's type.
+        bool m_hasIndicator;            ///< Whether the association has an indicator.
+        std::string m_indicatorString;  ///< The indicator string.
+        ObjectAssociationBase::sPtr m_spSerializableAssociation;  ///< The serializable association.
+    };
 
     mutable Mutex m_mutex;  ///< A mutex for locking this object during concurrent access.
 
@@ -295,14 +321,10 @@ private:
     Koala_wPtr m_wpKoala;        ///< Weak pointer to the instance of Koala.
 
     ObjectAssociationBase::sPtrSet
-        m_serializableAssociations;  ///< The list of serializable associations to other objects.
-    ObjectAssociationBase::sPtrSet
-        m_unserializableAssociations;  ///< The list of unserializable associations to other
-                                       ///< objects.
-    TypeInfoAssocMultiMap m_serializableAssocMultiMap;    ///< Multimap from the typeinfo to the
-                                                          ///< serializable associations.
-    TypeInfoAssocMultiMap m_unserializableAssocMultiMap;  ///< Multimap from the typeinfo to the
-                                                          ///< unserializable associations.
+        m_serializableAssociations;  ///< The serializable associations to other objects, held
+                                     ///< only so that they can be saved.
+    TypeInfoAssocMultiMap m_serializableAssocMultiMap;  ///< Multimap from the typeinfo to the
+                                                        ///< serializable associations.
 
     /**
      * @brief Test the suitability of an object to form an association with and throw an error if
@@ -314,101 +336,146 @@ private:
     void TestAssociationObjectSuitability(TOBJECT &&object) const;
 
     /**
-     * @brief Check whether an object type is in an assoc multimap.
+     * @brief Get the association table of this object's registry, which holds every association
+     * formed by this object.
      *
-     * @param assocMultiMap The map.
+     * @return The association table.
+     */
+    auto &GetAssociationTable() const;
+
+    /**
+     * @brief Find the registry of the objects of a given type.
      *
-     * @return Whether the object type was found.
+     * @return Pointer to the registry (null if it is not registered with koala).
      */
     template <typename TOBJECT>
-    auto IsObjectInAssocMultiMap(const TypeInfoAssocMultiMap &assocMultiMap) const noexcept;
+    auto FindAssociatedRegistry() const -> typename std::decay_t<TOBJECT>::Registry *;
 
     /**
-     * @brief Check whether an object type is in an assoc multimap with a given indicator.
+     * @brief Form an association between this object and another object, along with its
+     * reciprocal if requested.
      *
-     * @param assocMultiMap The map.
-     * @param indicator The indicator.
+     * @param thisObject This object, cast to the type with which the other object associates.
+     * @param object The other object.
+     * @param indicator The indicator (an empty string for none).
+     * @param reciprocate Whether to reciprocate the association.
      *
-     * @return Whether the object type was found.
+     * @return Whether the association was formed (false if it already existed).
      */
-    template <typename TOBJECT, typename TINDICATOR>
-    auto IsObjectInAssocMultiMap(const TypeInfoAssocMultiMap &assocMultiMap,
-                                 TINDICATOR &&indicator) const noexcept;
+    template <typename TTHIS, typename TOBJECT, typename TINDICATOR>
+    auto FormAssociation(TTHIS &thisObject, TOBJECT &object, const TINDICATOR &indicator,
+                         const bool reciprocate) -> bool;
 
     /**
-     * @brief Add a new association to the correct list and map.
+     * @brief Hold a serializable association to another object, so that it can be saved.
      *
-     * @param spAssociationBase The association to add.
+     * @param thisObject This object, cast to the type with which the other object associates.
+     * @param object The other object.
+     * @param indicator The indicator (an empty string for none).
+     */
+    template <typename TOBJECT, typename TTHIS, typename TINDICATOR>
+    void AddSerializableAssociation(TTHIS &thisObject, TOBJECT &object,
+                                    const TINDICATOR &indicator);
+
+    /**
+     * @brief Stop holding the serializable associations to another object that satisfy a
+     * predicate.
      *
-     * @return Success.
+     * @param objectId The ID of the other object.
+     * @param predicate The predicate, taking the association.
      */
-    template <typename TOBJECT>
-    auto AddAssociation(ObjectAssociationBase::sPtr spAssociationBase) noexcept;
+    template <typename TOBJECT, typename TPREDICATE>
+    void EraseSerializableAssociations(const ID_t objectId, TPREDICATE &&predicate) noexcept;
 
     /**
-     * @brief Remove an association to the correct list and map.
+     * @brief Find a serializable association held to another object (note: does not lock).
      *
-     * @param object The object whose association to remove.
+     * @param objectId The ID of the other object.
+     * @param typeTag The tag of the other object's type.
      *
-     * @return Success.
+     * @return The association (null if there is none).
      */
-    template <typename TOBJECT>
-    auto RemoveAssociation(TOBJECT &&object) noexcept;
+    auto FindSerializableAssociation(const ID_t objectId, const TypeTag typeTag) const
+        -> ObjectAssociationBase::sPtr;
 
     /**
-     * @brief Remove an association with a given indicator to the correct list and map.
+     * @brief Find out whether any of the objects with given IDs is still alive.
      *
-     * @param object The object whose association to remove.
-     * @param indicator The indicator.
+     * @param objectIds The IDs of the objects.
      *
-     * @return Success.
+     * @return Whether any is alive.
      */
-    template <typename TOBJECT, typename TINDICATOR>
-    auto RemoveAssociation(TOBJECT &&object, TINDICATOR &&indicator) noexcept;
+    template <typename TOBJECT>
+    auto IsAnyAssociatedObjectAlive(const IdVector &objectIds) const;
 
     /**
-     * @brief Get the associated objects from a map.
+     * @brief Get the live objects with given IDs.
      *
-     * @param assocMultiMap The map to use.
+     * @param objectIds The IDs of the objects.
      *
-     * @return The associated objects.
+     * @return The live objects.
      */
     template <typename TOBJECT>
-    auto GetAssociatedObjectsFromMap(const TypeInfoAssocMultiMap &assocMultiMap) const noexcept;
+    auto GetAssociatedObjectsFromIds(const IdVector &objectIds) const;
 
     /**
-     * @brief Get the associated objects with a given indicator from a map.
+     * @brief Get the live object with one of given IDs, throwing unless there is exactly one.
      *
-     * @param assocMultiMap The map to use.
-     * @param indicator The indicator.
+     * @param objectIds The IDs of the objects.
      *
-     * @return The associated objects.
+     * @return The live object.
      */
-    template <typename TOBJECT, typename TINDICATOR>
-    auto GetAssociatedObjectsFromMap(const TypeInfoAssocMultiMap &assocMultiMap,
-                                     TINDICATOR &&indicator) const noexcept;
+    template <typename TOBJECT>
+    auto &GetAssociatedObjectFromIds(const IdVector &objectIds) const;
 
     /**
-     * @brief Get an associated object from a map.
+     * @brief Get a range-based for-loop container over the live objects with given IDs.
      *
-     * @param assocMultiMap The map.
+     * @param objectIds The IDs of the objects.
      *
-     * @return A shared pointer to the associated object.
+     * @return A range-based for-loop container.
      */
     template <typename TOBJECT>
-    auto GetAssociatedObjectFromMap(const TypeInfoAssocMultiMap &assocMultiMap) const;
+    auto MakeAssociatedObjectContainer(const IdVector &objectIds) const;
 
     /**
-     * @brief Get an associated object with a given indicator from a map.
+     * @brief Get the table of association describers.
      *
-     * @param assocMultiMap The map.
-     * @param indicator The indicator.
+     * @return The table.
+     */
+    static auto GetAssociationDescriberTable() -> AssociationDescriberTable &;
+
+    /**
+     * @brief Register the function describing associated objects of a given type, once per type.
+     */
+    template <typename TOBJECT>
+    static void RegisterAssociationDescriber();
+
+    /**
+     * @brief Find the function describing associated objects of the type with a given tag.
+     *
+     * @param typeTag The type tag.
      *
-     * @return A shared pointer to the associated object.
+     * @return The describer (null if none was registered).
      */
-    template <typename TOBJECT, typename TINDICATOR>
-    auto GetAssociatedObjectFromMap(const TypeInfoAssocMultiMap &assocMultiMap,
-                                    TINDICATOR &&indicator) const;
+    static auto FindAssociationDescriber(const TypeTag typeTag) -> AssociationDescriber;
+
+    /**
+     * @brief Describe an associated object of a given type.
+     *
+     * @param source The object from which the association was formed.
+     * @param objectId The ID of the associated object.
+     * @param isCerealSerializable Whether the association is cereal-serializable.
+     * @param hasIndicator Whether the association has an indicator.
+     * @param indicatorString The indicator string.
+     *
+     * @return The association information.
+     */
+    template <typename TOBJECT>
+    static auto DescribeAssociatedObject(const RegisteredObjectTemplate &source,
+                                         const ID_t objectId, const bool isCerealSerializable,
+                                         const bool hasIndicator, std::string indicatorString)
+        -> AssociationInformation;
 
 #ifdef KOALA_ENABLE_CEREAL
     /**
@@ -426,6 +493,14 @@ private:
      */
     template <typename TARCHIVE>
     void load(TARCHIVE &archive);
+
+    /**
+     * @brief Restore the rows of the loaded serializable associations to an association table,
+     * which is not itself saved.
+     *
+     * @param associationTable The association table.
+     */
+    void RestoreAssociations(AssociationTable &associationTable) const;
 #endif  // #ifdef KOALA_ENABLE_CEREAL
 
 public:
@@ -520,6 +595,14 @@ public:
      */
     auto GetRegistryName() const;
 
+    /**
+     * @brief Estimate the memory held by this object beyond its own payload: its serializable
+     * associations and its mutex (its association rows are counted by its registry).
+     *
+     * @return The memory report.
+     */
+    auto MemoryUsage() const;
+
     /**
      * @brief Find out whether there exists any associations between this object and one of a given
      * type.
@@ -527,7 +610,7 @@ public:
      * @return Whether there exist any associations.
      */
     template <typename TOBJECT>
-    auto IsAssociated() const noexcept;
+    auto IsAssociated() const;
 
     /**
      * @brief Find out whether there exists any associations between this object and one of a given
@@ -538,7 +621,7 @@ public:
      * @return Whether there exist any associations.
      */
     template <typename TOBJECT, typename TINDICATOR>
-    auto IsAssociated(TINDICATOR &&indicator) const noexcept;
+    auto IsAssociated(TINDICATOR &&indicator) const;
 
     /**
      * @brief Form an association between this object and another object.
@@ -548,9 +631,21 @@ public:
      *
      * @return Success.
      */
-    template <typename TTHIS = TBASE_D, typename TOBJECT>
+    template <typename TTHIS = TBASE_D, typename TOBJECT,
+              typename = std::enable_if_t<!IsHandle<std::decay_t<TOBJECT>>::value>>
     auto Associate(TOBJECT &&object, bool reciprocate = true);
 
+    /**
+     * @brief Form an association between this object and the object with a given handle.
+     *
+     * @param handle The handle of the other object.
+     * @param reciprocate Whether to reciprocate the association.
+     *
+     * @return Success.
+     */
+    template <typename TTHIS = TBASE_D, typename TOBJECT>
+    auto Associate(const Handle<TOBJECT> &handle, bool reciprocate = true);
+
     /**
      * @brief Form an association between this object and another object.
      *
@@ -560,20 +655,47 @@ public:
      *
      * @return Success.
      */
-    template <typename TTHIS = TBASE_D, typename TOBJECT, typename TINDICATOR>
+    template <typename TTHIS = TBASE_D, typename TOBJECT, typename TINDICATOR,
+              typename = std::enable_if_t<!IsHandle<std::decay_t<TOBJECT>>::value>>
     auto Associate(TOBJECT &&object, TINDICATOR &&indicator, bool reciprocate = true);
 
     /**
-     * @brief Dissolve the association between this object and another object.
+     * @brief Form an association between this object and the object with a given handle.
+     *
+     * @param handle The handle of the other object.
+     * @param indicator The indicator.
+     * @param reciprocate Whether to reciprocate the association.
+     *
+     * @return Success.
+     */
+    template <typename TTHIS = TBASE_D, typename TOBJECT, typename TINDICATOR>
+    auto Associate(const Handle<TOBJECT> &handle, TINDICATOR &&indicator, bool reciprocate = true);
+
+    /**
+     * @brief Dissolve every association between this object and another object, whatever its
+     * indicator.
      *
      * @param object The other object.
      * @param reciprocate Whether to reciprocate the dissolution.
      *
      * @return Success.
      */
-    template <typename TTHIS = TBASE_D, typename TOBJECT>
+    template <typename TTHIS = TBASE_D, typename TOBJECT,
+              typename = std::enable_if_t<!IsHandle<std::decay_t<TOBJECT>>::value>>
     auto Dissociate(TOBJECT &&object, bool reciprocate = true);
 
+    /**
+     * @brief Dissolve every association between this object and the object with a given handle,
+     * whatever its indicator.
+     *
+     * @param handle The handle of the other object.
+     * @param reciprocate Whether to reciprocate the dissolution.
+     *
+     * @return Success.
+     */
+    template <typename TTHIS = TBASE_D, typename TOBJECT>
+    auto Dissociate(const Handle<TOBJECT> &handle, bool reciprocate = true);
+
     /**
      * @brief Dissolve the association between this object and another object.
      *
@@ -583,9 +705,23 @@ public:
      *
      * @return Success.
      */
-    template <typename TTHIS = TBASE_D, typename TOBJECT, typename TINDICATOR>
+    template <typename TTHIS = TBASE_D, typename TOBJECT, typename TINDICATOR,
+              typename = std::enable_if_t<!IsHandle<std::decay_t<TOBJECT>>::value>>
     auto Dissociate(TOBJECT &&object, TINDICATOR &&indicator, bool reciprocate = true);
 
+    /**
+     * @brief Dissolve the association between this object and the object with a given handle.
+     *
+     * @param handle The handle of the other object.
+     * @param indicator The indicator.
+     * @param reciprocate Whether to reciprocate the dissolution.
+     *
+     * @return Success.
+     */
+    template <typename TTHIS = TBASE_D, typename TOBJECT, typename TINDICATOR>
+    auto Dissociate(const Handle<TOBJECT> &handle, TINDICATOR &&indicator,
+                    bool reciprocate = true);
+
     /**
      * @brief Get a list of the associated objects of a given type.
      *
@@ -625,7 +761,7 @@ public:
      * @return A range-based for-loop container.
      */
     template <typename TOBJECT = TBASE_D>
-    auto AssociatedObjects() const noexcept;
+    auto AssociatedObjects() const;
 
     /**
      * @brief Get a range-based for-loop container for looping through the associated objects of a
@@ -634,7 +770,7 @@ public:
      * @return A range-based for-loop container.
      */
     template <typename TOBJECT = TBASE_D, typename TINDICATOR>
-    auto AssociatedObjects(TINDICATOR &&indicator) const noexcept;
+    auto AssociatedObjects(TINDICATOR &&indicator) const;
 
     /**
      * @brief Find out whether we can cast this object as a given type.
@@ -30,9 +30,7 @@ RegisteredObjectTemplate<TBASE, TALIAS>::RegisteredObjectTemplate(Registry_wPtr
       m_wpRegistry{std::move_if_noexcept(wpRegistry)},
       m_wpKoala{std::move_if_noexcept(wpKoala)},
       m_serializableAssociations{},
-      m_unserializableAssociations{},
-      m_serializableAssocMultiMap{},
-      m_unserializableAssocMultiMap{}
+      m_serializableAssocMultiMap{}
 {
     static_assert(!std::is_same<TBASE_D, kl::ID_t>::value,
                   "Cannot instantiate a registered object if the base type is the same as the ID "
@@ -82,9 +80,7 @@ RegisteredObjectTemplate<TBASE, TALIAS>::RegisteredObjectTemplate() noexcept
       m_wpRegistry{},
       m_wpKoala{},
       m_serializableAssociations{},
-      m_unserializableAssociations{},
-      m_serializableAssocMultiMap{},
-      m_unserializableAssocMultiMap{}
+      m_serializableAssocMultiMap{}
 {
     static_assert(!std::is_same<TBASE_D, kl::ID_t>::value,
                   "Cannot instantiate a registered object if the base type is the same as the ID "
@@ -127,199 +123,179 @@ void RegisteredObjectTemplate<TBASE, TALIAS>::TestAssociationObjectSuitability(
 
 //--------------------------------------------------------------------------------------------------
 
+template <typename TBASE, typename TALIAS>
+inline auto &RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociationTable() const
+{
+    return this->GetRegistry().m_associationTable;
+}
+
+//--------------------------------------------------------------------------------------------------
+
 template <typename TBASE, typename TALIAS>
 template <typename TOBJECT>
-auto RegisteredObjectTemplate<TBASE, TALIAS>::IsObjectInAssocMultiMap(
-    const TypeInfoAssocMultiMap &assocMultiMap) const noexcept
+auto RegisteredObjectTemplate<TBASE, TALIAS>::FindAssociatedRegistry() const ->
+    typename std::decay_t<TOBJECT>::Registry *
 {
     using TOBJECT_D = std::decay_t<TOBJECT>;
 
-    // Check if there is at least one live associated object of the correct type.
-    const auto serRet = assocMultiMap.equal_range(typeid(TOBJECT_D).name());
-    for (auto iter = serRet.first; iter != serRet.second; ++iter)
-    {
-        if (iter->second->IsAlive()) return true;
-    }
+    const auto &koala = this->GetKoala();
+    if (!koala.template HasRegistry<TOBJECT_D>()) return nullptr;
 
-    return false;
+    return &koala.template FetchRegistry<TOBJECT_D>();
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-template <typename TOBJECT, typename TINDICATOR>
-auto RegisteredObjectTemplate<TBASE, TALIAS>::IsObjectInAssocMultiMap(
-    const TypeInfoAssocMultiMap &assocMultiMap, TINDICATOR &&indicator) const noexcept
+template <typename TTHIS, typename TOBJECT, typename TINDICATOR>
+auto RegisteredObjectTemplate<TBASE, TALIAS>::FormAssociation(TTHIS &thisObject, TOBJECT &object,
+                                                              const TINDICATOR &indicator,
+                                                              const bool reciprocate) -> bool
 {
+    using TTHIS_D = std::decay_t<TTHIS>;
     using TOBJECT_D = std::decay_t<TOBJECT>;
 
-    // Check if there is at least one live associated object of the correct type with the provided
-    // indicator.
-    const auto ret = assocMultiMap.equal_range(typeid(TOBJECT_D).name());
-    for (auto iter = ret.first; iter != ret.second; ++iter)
+    RegisterAssociationDescriber<TOBJECT_D>();
+
+    auto &associationTable = this->GetAssociationTable();
+    const auto typeTag = GetTypeTag<TOBJECT_D>();
+    const auto isFormed = associationTable.Associate(m_id, object.ID(), typeTag, indicator);
+
+    // The reciprocal association is formed in the other object's registry; if it or the
+    // serializable association cannot be formed, the association is dissolved again.
+    auto isReciprocated = false;
+
+    try
     {
-        if (const auto spCastAssociation =
-                std::dynamic_pointer_cast<ObjectAssociation<TOBJECT_D, std::decay_t<TINDICATOR>>>(
-                    iter->second))
+        if (reciprocate)
+            isReciprocated = object.template Associate<TOBJECT_D>(thisObject, indicator, false);
+
+        if constexpr (TTHIS_D::IsCerealSerializable() && TOBJECT_D::IsCerealSerializable())
         {
-            if (spCastAssociation->Indicator() == indicator && spCastAssociation->IsAlive())
-                return true;
+            if (isFormed)
+                this->AddSerializableAssociation<TOBJECT_D>(thisObject, object, indicator);
         }
     }
+    catch (...)
+    {
+        if (isReciprocated) object.template Dissociate<TOBJECT_D>(thisObject, indicator, false);
+        if (isFormed) associationTable.Dissociate(m_id, object.ID(), typeTag, indicator);
+        throw;
+    }
 
-    return false;
+    return isFormed;
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-template <typename TOBJECT>
-auto RegisteredObjectTemplate<TBASE, TALIAS>::AddAssociation(
-    ObjectAssociationBase::sPtr spAssociationBase) noexcept
+template <typename TOBJECT, typename TTHIS, typename TINDICATOR>
+void RegisteredObjectTemplate<TBASE, TALIAS>::AddSerializableAssociation(
+    TTHIS &thisObject, TOBJECT &object, const TINDICATOR &indicator)
 {
     using TOBJECT_D = std::decay_t<TOBJECT>;
+    using IndicatorTraits = AssociationTable::IndicatorTraits<TINDICATOR>;
+    using TSTORED = typename IndicatorTraits::Stored;
 
-    if (spAssociationBase->IsCerealSerializable())
-    {
-        // Serializable association.
-        if (m_serializableAssociations.insert(spAssociationBase).second)
-        {
-            m_serializableAssocMultiMap.emplace(typeid(TOBJECT_D).name(),
-                                                std::move(spAssociationBase));
-            return true;
-        }
+    // An empty string indicator stands for no indicator, as it does in the association table.
+    auto spAssociationBase = ObjectAssociationBase::sPtr{};
+    auto hasIndicator = true;
 
-        return false;
+    if constexpr (std::is_same<TSTORED, std::string>::value)
+        hasIndicator = !IndicatorTraits::Key(indicator).empty();
+
+    if (hasIndicator)
+    {
+        spAssociationBase.reset(new ObjectAssociation<TOBJECT_D, TSTORED>{
+            thisObject, std::forward<TOBJECT_D>(object), false,
+            TSTORED(IndicatorTraits::Key(indicator))});
     }
 
-    // Unserializable association.
-    if (m_unserializableAssociations.insert(spAssociationBase).second)
+    else
     {
-        m_unserializableAssocMultiMap.emplace(typeid(TOBJECT_D).name(),
-                                              std::move(spAssociationBase));
-        return true;
+        spAssociationBase.reset(
+            new ObjectAssociation<TOBJECT_D>{thisObject, std::forward<TOBJECT_D>(object), false});
     }
 
-    return false;
+    const auto lock = WriteLock{m_mutex};
+    m_serializableAssociations.insert(spAssociationBase);
+
+    try
+    {
+        m_serializableAssocMultiMap[GetTypeTag<TOBJECT_D>()].insert(spAssociationBase);
+    }
+    catch (...)
+    {
+        m_serializableAssociations.erase(spAssociationBase);
+        throw;
+    }
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-template <typename TOBJECT>
-auto RegisteredObjectTemplate<TBASE, TALIAS>::RemoveAssociation(TOBJECT &&object) noexcept
+template <typename TOBJECT, typename TPREDICATE>
+void RegisteredObjectTemplate<TBASE, TALIAS>::EraseSerializableAssociations(
+    const ID_t objectId, TPREDICATE &&predicate) noexcept
 {
     using TOBJECT_D = std::decay_t<TOBJECT>;
 
-    if (object.IsCerealSerializable())
-    {
-        // Serializable association.
-        const auto ret = m_serializableAssocMultiMap.equal_range(typeid(TOBJECT_D).name());
+    const auto lock = WriteLock{m_mutex};
+    const auto findIter = m_serializableAssocMultiMap.find(GetTypeTag<TOBJECT_D>());
+    if (findIter == m_serializableAssocMultiMap.end()) return;
 
-        for (auto iter = ret.first; iter != ret.second; ++iter)
-        {
-            if (iter->second->ID() != object.ID() &&
-                std::dynamic_pointer_cast<ObjectAssociation<TOBJECT_D>>(iter->second))
-            {
-                m_serializableAssocMultiMap.erase(iter);
-
-                const auto findIter =
-                    m_serializableAssociations.find(iter->second);  // guaranteed to be found
-                KL_ASSERT(findIter != m_serializableAssociations.end(),
-                          "Association information is corrupted");
-
-                m_serializableAssociations.erase(findIter);
-                return true;
-            }
-        }
-    }
+    auto &associations = findIter->second;
 
-    else
+    for (auto iter = associations.begin(); iter != associations.end();)
     {
-        // Unserializable association.
-        const auto ret = m_unserializableAssocMultiMap.equal_range(typeid(TOBJECT_D).name());
-
-        for (auto iter = ret.first; iter != ret.second; ++iter)
+        if (((*iter)->ID() != objectId) || !predicate(*iter))
         {
-            if (iter->second->ID() != object.ID() &&
-                std::dynamic_pointer_cast<ObjectAssociation<TOBJECT_D>>(iter->second))
-            {
-                m_unserializableAssocMultiMap.erase(iter);
-
-                const auto findIter =
-                    m_unserializableAssociations.find(iter->second);  // guaranteed to be found
-                KL_ASSERT(findIter != m_unserializableAssociations.end(),
-                          "Association information is corrupted");
-
-                m_unserializableAssociations.erase(findIter);
-                return true;
-            }
+            ++iter;
+            continue;
         }
+
+        m_serializableAssociations.erase(*iter);
+        iter = associations.erase(iter);
     }
 
-    return false;
+    if (associations.empty()) m_serializableAssocMultiMap.erase(findIter);
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-template <typename TOBJECT, typename TINDICATOR>
-auto RegisteredObjectTemplate<TBASE, TALIAS>::RemoveAssociation(TOBJECT &&object,
-                                                                TINDICATOR &&indicator) noexcept
+auto RegisteredObjectTemplate<TBASE, TALIAS>::FindSerializableAssociation(
+    const ID_t objectId, const TypeTag typeTag) const -> ObjectAssociationBase::sPtr
 {
-    using TOBJECT_D = std::decay_t<TOBJECT>;
-    using TINDICATOR_D = std::decay_t<TINDICATOR>;
+    const auto findIter = m_serializableAssocMultiMap.find(typeTag);
+    if (findIter == m_serializableAssocMultiMap.end()) return nullptr;
 
-    if (object.IsCerealSerializable())
+    for (const auto &spAssociationBase : findIter->second)
     {
-        // Serializable association.
-        const auto ret = m_serializableAssocMultiMap.equal_range(typeid(TOBJECT_D).name());
-
-        for (auto iter = ret.first; iter != ret.second; ++iter)
-        {
-            if (iter->second->ID() != object.ID()) continue;
-
-            const auto spCastAssociation =
-                std::dynamic_pointer_cast<ObjectAssociation<TOBJECT_D, TINDICATOR_D>>(iter->second);
-            if (spCastAssociation && spCastAssociation->Indicator() == indicator)
-            {
-                m_serializableAssocMultiMap.erase(iter);
-
-                const auto findIter =
-                    m_serializableAssociations.find(iter->second);  // guaranteed to be found
-                KL_ASSERT(findIter != m_serializableAssociations.end(),
-                          "Association information is corrupted");
-
-                m_serializableAssociations.erase(findIter);
-                return true;
-            }
-        }
+        if (spAssociationBase->ID() == objectId) return spAssociationBase;
     }
 
-    else
-    {
-        // Unserializable association.
-        const auto ret = m_unserializableAssocMultiMap.equal_range(typeid(TOBJECT_D).name());
+    return nullptr;
+}
 
-        for (auto iter = ret.first; iter != ret.second; ++iter)
-        {
-            if (iter->second->ID() != object.ID()) continue;
+//--------------------------------------------------------------------------------------------------
 
-            const auto spCastAssociation =
-                std::dynamic_pointer_cast<ObjectAssociation<TOBJECT_D, TINDICATOR_D>>(iter->second);
-            if (spCastAssociation && spCastAssociation->Indicator() == indicator)
-            {
-                m_unserializableAssocMultiMap.erase(iter);
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+auto RegisteredObjectTemplate<TBASE, TALIAS>::IsAnyAssociatedObjectAlive(
+    const IdVector &objectIds) const
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
 
-                const auto findIter =
-                    m_unserializableAssociations.find(iter->second);  // guaranteed to be found
-                KL_ASSERT(findIter != m_unserializableAssociations.end(),
-                          "Association information is corrupted");
+    if (objectIds.empty()) return false;
 
-                m_unserializableAssociations.erase(findIter);
-                return true;
-            }
-        }
+    const auto pRegistry = this->FindAssociatedRegistry<TOBJECT_D>();
+    if (!pRegistry) return false;
+
+    // The table keeps rows naming deleted objects, so each object is looked up in its registry.
+    for (const auto objectId : objectIds)
+    {
+        if (pRegistry->Resolve(Handle<TOBJECT_D>{objectId})) return true;
     }
 
     return false;
@@ -329,22 +305,21 @@ auto RegisteredObjectTemplate<TBASE, TALIAS>::RemoveAssociation(TOBJECT &&object
 
 template <typename TBASE, typename TALIAS>
 template <typename TOBJECT>
-auto RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociatedObjectsFromMap(
-    const TypeInfoAssocMultiMap &assocMultiMap) const noexcept
+auto RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociatedObjectsFromIds(
+    const IdVector &objectIds) const
 {
     using TOBJECT_D = std::decay_t<TOBJECT>;
 
-    // Add all live associated objects to the list.
     auto associatedObjects = typename TOBJECT_D::UnorderedRefSet{};
-    const auto ret = assocMultiMap.equal_range(typeid(TOBJECT_D).name());
+    if (objectIds.empty()) return associatedObjects;
+
+    const auto pRegistry = this->FindAssociatedRegistry<TOBJECT_D>();
+    if (!pRegistry) return associatedObjects;
 
-    for (auto iter = ret.first; iter != ret.second; ++iter)
+    for (const auto objectId : objectIds)
     {
-        if (const auto spCastAssociation =
-                std::dynamic_pointer_cast<ObjectAssociation<TOBJECT_D>>(iter->second))
-        {
-            if (spCastAssociation->IsAlive()) associatedObjects.insert(spCastAssociation->Get());
-        }
+        if (const auto pObject = pRegistry->Resolve(Handle<TOBJECT_D>{objectId}))
+            associatedObjects.insert(*pObject);
     }
 
     return associatedObjects;
@@ -353,99 +328,135 @@ auto RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociatedObjectsFromMap(
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-template <typename TOBJECT, typename TINDICATOR>
-auto RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociatedObjectsFromMap(
-    const TypeInfoAssocMultiMap &assocMultiMap, TINDICATOR &&indicator) const noexcept
+template <typename TOBJECT>
+auto &RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociatedObjectFromIds(
+    const IdVector &objectIds) const
 {
     using TOBJECT_D = std::decay_t<TOBJECT>;
 
-    // Add all live associated objects to the list.
-    auto associatedObjects = typename TOBJECT_D::UnorderedRefSet{};
-    const auto ret = assocMultiMap.equal_range(typeid(TOBJECT_D).name());
+    const auto pRegistry = objectIds.empty() ? nullptr : this->FindAssociatedRegistry<TOBJECT_D>();
+    auto pReturnObject = static_cast<TOBJECT_D *>(nullptr);
 
-    for (auto iter = ret.first; iter != ret.second; ++iter)
+    for (auto iter = objectIds.cbegin(); pRegistry && (iter != objectIds.cend()); ++iter)
     {
-        if (const auto spCastAssociation =
-                std::dynamic_pointer_cast<ObjectAssociation<TOBJECT_D, std::decay_t<TINDICATOR>>>(
-                    iter->second))
+        const auto pObject = pRegistry->Resolve(Handle<TOBJECT_D>{*iter});
+        if (!pObject) continue;
+
+        if (pReturnObject)
         {
-            if (spCastAssociation->Indicator() == indicator && spCastAssociation->IsAlive())
-                associatedObjects.insert(spCastAssociation->Get());
+            KL_THROW(
+                "Used 'GetAssociatedObject' but there was more than one association for object of "
+                "base type "
+                << KL_WHITE_BOLD << this->GetRegistry().PrintableBaseName());
         }
+
+        pReturnObject = pObject;
     }
 
-    return associatedObjects;
+    if (pReturnObject) return *pReturnObject;
+
+    KL_THROW("There were no live objects of this type found for object of base type "
+             << KL_WHITE_BOLD << this->GetRegistry().PrintableBaseName());
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
 template <typename TOBJECT>
-auto RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociatedObjectFromMap(
-    const TypeInfoAssocMultiMap &assocMultiMap) const
+auto RegisteredObjectTemplate<TBASE, TALIAS>::MakeAssociatedObjectContainer(
+    const IdVector &objectIds) const
 {
     using TOBJECT_D = std::decay_t<TOBJECT>;
-    auto spReturnAssociation = typename ObjectAssociation<TOBJECT_D>::sPtr{nullptr};
+    using TOBJECT_sPtrVector = std::vector<std::shared_ptr<TOBJECT_D>>;
+
+    // The container owns shared pointers to the live objects, so it needs no lock.
+    auto objects = TOBJECT_sPtrVector{};
+    const auto pRegistry = objectIds.empty() ? nullptr : this->FindAssociatedRegistry<TOBJECT_D>();
 
-    const auto ret = assocMultiMap.equal_range(typeid(TOBJECT_D).name());
-    for (auto iter = ret.first; iter != ret.second; ++iter)
+    for (auto iter = objectIds.cbegin(); pRegistry && (iter != objectIds.cend()); ++iter)
     {
-        if (const auto spCastAssociation =
-                std::dynamic_pointer_cast<ObjectAssociation<TOBJECT_D>>(iter->second))
-        {
-            if (spCastAssociation->IsAlive())
-            {
-                if (spReturnAssociation)
-                {
-                    KL_THROW(
-                        "Used 'GetAssociatedObject' but there was more than one association for "
-                        "object of "
-                        "base type "
-                        << KL_WHITE_BOLD << this->GetRegistry().PrintableBaseName());
-                }
-
-                spReturnAssociation = spCastAssociation;
-            }
-        }
+        if (auto spObject = pRegistry->template FindSharedPointer<TOBJECT_D>(*iter))
+            objects.push_back(std::move(spObject));
     }
 
-    return spReturnAssociation;
+    return MakeRangeBasedContainer<TOBJECT_sPtrVector, TOBJECT_D, TOBJECT_D, TOBJECT_D>(
+        [](const std::shared_ptr<TOBJECT_D> &) { return true; },
+        [](const std::shared_ptr<TOBJECT_D> &spObject) { return spObject; },
+        [](const std::shared_ptr<TOBJECT_D> &spObject) -> auto & { return *spObject; },
+        ReadLock{}, ReadLock{}, std::move(objects));
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-template <typename TOBJECT, typename TINDICATOR>
-auto RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociatedObjectFromMap(
-    const TypeInfoAssocMultiMap &assocMultiMap, TINDICATOR &&indicator) const
+auto RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociationDescriberTable()
+    -> AssociationDescriberTable &
+{
+    static auto associationDescriberTable = AssociationDescriberTable{};
+    return associationDescriberTable;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+void RegisteredObjectTemplate<TBASE, TALIAS>::RegisterAssociationDescriber()
 {
     using TOBJECT_D = std::decay_t<TOBJECT>;
-    auto spReturnAssociation = typename ObjectAssociation<TOBJECT_D>::sPtr{nullptr};
 
-    const auto ret = assocMultiMap.equal_range(typeid(TOBJECT_D).name());
-    for (auto iter = ret.first; iter != ret.second; ++iter)
-    {
-        if (const auto spCastAssociation =
-                std::dynamic_pointer_cast<ObjectAssociation<TOBJECT_D, std::decay_t<TINDICATOR>>>(
-                    iter->second))
-        {
-            if (spCastAssociation.Indicator() == indicator && spCastAssociation->IsAlive())
-            {
-                if (spReturnAssociation)
-                {
-                    KL_THROW(
-                        "Used 'GetAssociatedObject' but there was more than one association for "
-                        "object of "
-                        "base type "
-                        << KL_WHITE_BOLD << this->GetRegistry().PrintableBaseName());
-                }
-
-                spReturnAssociation = spCastAssociation;
-            }
-        }
-    }
+    static const auto isRegistered = []() {
+        auto &associationDescriberTable = GetAssociationDescriberTable();
+        const auto lock = WriteLock{associationDescriberTable.m_mutex};
+
+        associationDescriberTable.m_describers.emplace(
+            GetTypeTag<TOBJECT_D>(),
+            &RegisteredObjectTemplate::template DescribeAssociatedObject<TOBJECT_D>);
 
-    return spReturnAssociation;
+        return true;
+    }();
+
+    static_cast<void>(isRegistered);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+auto RegisteredObjectTemplate<TBASE, TALIAS>::FindAssociationDescriber(const TypeTag typeTag)
+    -> AssociationDescriber
+{
+    auto &associationDescriberTable = GetAssociationDescriberTable();
+    const auto lock = ReadLock{associationDescriberTable.m_mutex};
+
+    const auto findIter = associationDescriberTable.m_describers.find(typeTag);
+    return (findIter == associationDescriberTable.m_describers.end()) ? nullptr : findIter->second;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+auto RegisteredObjectTemplate<TBASE, TALIAS>::DescribeAssociatedObject(
+    const RegisteredObjectTemplate &source, const ID_t objectId, const bool isCerealSerializable,
+    const bool hasIndicator, std::string indicatorString) -> AssociationInformation
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    const auto pRegistry = source.template FindAssociatedRegistry<TOBJECT_D>();
+    const auto spObject =
+        pRegistry ? pRegistry->template FindSharedPointer<TOBJECT_D>(objectId) : nullptr;
+
+    if (!spObject)
+        return AssociationInformation{objectId, false,         false,         false,
+                                      std::string{}, std::string{}, std::string{}, std::string{}};
+
+    return AssociationInformation{objectId,
+                                  true,
+                                  isCerealSerializable,
+                                  hasIndicator,
+                                  spObject->GetIdentifierString(),
+                                  spObject->PrintableName(),
+                                  spObject->GetRegistry().PrintableBaseName(),
+                                  std::move(indicatorString)};
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -455,7 +466,18 @@ template <typename TBASE, typename TALIAS>
 template <typename TARCHIVE>
 inline void RegisteredObjectTemplate<TBASE, TALIAS>::save(TARCHIVE &archive) const
 {
-    archive(m_wpRegistry, m_id, m_wpKoala, m_serializableAssociations, m_serializableAssocMultiMap);
+    // Type tags are only meaningful within the running process, so the map is saved by type name.
+    auto typeNameAssocMultiMap = TypeNameAssocMultiMap{};
+
+    for (const auto &assocElement : m_serializableAssocMultiMap)
+    {
+        const auto typeName = GetTypeName(assocElement.first);
+
+        for (const auto &spAssociationBase : assocElement.second)
+            typeNameAssocMultiMap.emplace(typeName, spAssociationBase);
+    }
+
+    archive(m_wpRegistry, m_id, m_wpKoala, m_serializableAssociations, typeNameAssocMultiMap);
 }
 #endif  // #ifdef KOALA_ENABLE_CEREAL
 
@@ -466,7 +488,30 @@ template <typename TBASE, typename TALIAS>
 template <typename TARCHIVE>
 inline void RegisteredObjectTemplate<TBASE, TALIAS>::load(TARCHIVE &archive)
 {
-    archive(m_wpRegistry, m_id, m_wpKoala, m_serializableAssociations, m_serializableAssocMultiMap);
+    auto typeNameAssocMultiMap = TypeNameAssocMultiMap{};
+    archive(m_wpRegistry, m_id, m_wpKoala, m_serializableAssociations, typeNameAssocMultiMap);
+
+    m_serializableAssocMultiMap.clear();
+
+    for (const auto &assocElement : typeNameAssocMultiMap)
+        m_serializableAssocMultiMap[GetTypeTag(assocElement.first)].insert(assocElement.second);
+}
+#endif  // #ifdef KOALA_ENABLE_CEREAL
+
+//--------------------------------------------------------------------------------------------------
+
+#ifdef KOALA_ENABLE_CEREAL
+template <typename TBASE, typename TALIAS>
+void RegisteredObjectTemplate<TBASE, TALIAS>::RestoreAssociations(
+    AssociationTable &associationTable) const
+{
+    const auto lock = ReadLock{m_mutex};
+
+    for (const auto &assocElement : m_serializableAssocMultiMap)
+    {
+        for (const auto &spAssociationBase : assocElement.second)
+            spAssociationBase->RestoreAssociation(associationTable, m_id, assocElement.first);
+    }
 }
 #endif  // #ifdef KOALA_ENABLE_CEREAL
 
@@ -481,9 +526,7 @@ RegisteredObjectTemplate<TBASE, TALIAS>::RegisteredObjectTemplate(
       m_wpRegistry{},
       m_wpKoala{},
       m_serializableAssociations{},
-      m_unserializableAssociations{},
-      m_serializableAssocMultiMap{},
-      m_unserializableAssocMultiMap{}
+      m_serializableAssocMultiMap{}
 {
     const auto thisLock = WriteLock{other.m_mutex};
     const auto otherLock = ReadLock{other.m_mutex};
@@ -492,9 +535,7 @@ RegisteredObjectTemplate<TBASE, TALIAS>::RegisteredObjectTemplate(
     m_wpRegistry = other.m_wpRegistry;
     m_wpKoala = other.m_wpKoala;
     m_serializableAssociations = other.m_serializableAssociations;
-    m_unserializableAssociations = other.m_unserializableAssociations;
     m_serializableAssocMultiMap = other.m_serializableAssocMultiMap;
-    m_unserializableAssocMultiMap = other.m_unserializableAssocMultiMap;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -507,9 +548,7 @@ RegisteredObjectTemplate<TBASE, TALIAS>::RegisteredObjectTemplate(
       m_wpRegistry{},
       m_wpKoala{},
       m_serializableAssociations{},
-      m_unserializableAssociations{},
-      m_serializableAssocMultiMap{},
-      m_unserializableAssocMultiMap{}
+      m_serializableAssocMultiMap{}
 {
     const auto thisLock = WriteLock{other.m_mutex};
     const auto otherLock = WriteLock{other.m_mutex};
@@ -518,9 +557,7 @@ RegisteredObjectTemplate<TBASE, TALIAS>::RegisteredObjectTemplate(
     m_wpRegistry = std::move_if_noexcept(other.m_wpRegistry);
     m_wpKoala = std::move_if_noexcept(other.m_wpKoala);
     m_serializableAssociations = std::move_if_noexcept(other.m_serializableAssociations);
-    m_unserializableAssociations = std::move_if_noexcept(other.m_unserializableAssociations);
     m_serializableAssocMultiMap = std::move_if_noexcept(other.m_serializableAssocMultiMap);
-    m_unserializableAssocMultiMap = std::move_if_noexcept(other.m_unserializableAssocMultiMap);
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -539,10 +576,8 @@ auto &RegisteredObjectTemplate<TBASE, TALIAS>::operator=(
         m_wpRegistry = other.m_wpRegistry;
         m_wpKoala = other.m_wpKoala;
         m_serializableAssociations = other.m_serializableAssociations;
-        m_unserializableAssociations = other.m_unserializableAssociations;
-        m_serializableAssocMultiMap = other.m_serializableAssocMultiMap;
-        m_unserializableAssocMultiMap = other.m_unserializableAssocMultiMap;
-    }
+            m_serializableAssocMultiMap = other.m_serializableAssocMultiMap;
+            }
 
     return *this;
 }
@@ -563,10 +598,8 @@ auto &RegisteredObjectTemplate<TBASE, TALIAS>::operator=(
         m_wpRegistry = std::move_if_noexcept(other.m_wpRegistry);
         m_wpKoala = std::move_if_noexcept(other.m_wpKoala);
         m_serializableAssociations = std::move_if_noexcept(other.m_serializableAssociations);
-        m_unserializableAssociations = std::move_if_noexcept(other.m_unserializableAssociations);
-        m_serializableAssocMultiMap = std::move_if_noexcept(other.m_serializableAssocMultiMap);
-        m_unserializableAssocMultiMap = std::move_if_noexcept(other.m_unserializableAssocMultiMap);
-    }
+            m_serializableAssocMultiMap = std::move_if_noexcept(other.m_serializableAssocMultiMap);
+            }
 
     return *this;
 }
@@ -586,14 +619,52 @@ inline auto &RegisteredObjectTemplate<TBASE, TALIAS>::GetRegistry() const
 template <typename TBASE, typename TALIAS>
 auto RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociationInformation() const
 {
-    const auto lock = ReadLock{m_mutex};
+    // The rows are copied out first so that describing the associated objects, which locks their
+    // registries, happens without the table lock held.
+    auto associationRows = std::vector<AssociationRow>{};
+    this->GetAssociationTable().ForEachAssociation(
+        m_id, [&](const ID_t targetId, const TypeTag typeTag, const bool hasIndicator,
+                  std::string indicatorString) {
+            associationRows.push_back(AssociationRow{targetId, typeTag, hasIndicator,
+                                                     std::move(indicatorString), nullptr});
+        });
+
+    {
+        const auto lock = ReadLock{m_mutex};
+        for (auto &associationRow : associationRows)
+        {
+            associationRow.m_spSerializableAssociation = this->FindSerializableAssociation(
+                associationRow.m_targetId, associationRow.m_typeTag);
+        }
+    }
 
     auto associationInformationList = AssociationInformation::Vector{};
-    for (const auto &spAssociationBase : m_serializableAssociations)
-        associationInformationList.push_back(AssociationInformation{spAssociationBase});
+    for (auto &associationRow : associationRows)
+    {
+        const auto isCerealSerializable = (associationRow.m_spSerializableAssociation != nullptr);
+
+        if (const auto describer = FindAssociationDescriber(associationRow.m_typeTag))
+        {
+            associationInformationList.push_back(
+                describer(*this, associationRow.m_targetId, isCerealSerializable,
+                          associationRow.m_hasIndicator,
+                          std::move(associationRow.m_indicatorString)));
+        }
+
+        else if (isCerealSerializable)
+        {
+            associationInformationList.push_back(
+                AssociationInformation{associationRow.m_spSerializableAssociation});
+        }
 
-    for (const auto &spAssociationBase : m_unserializableAssociations)
-        associationInformationList.push_back(AssociationInformation{spAssociationBase});
+        else
+        {
+            associationInformationList.push_back(
+                AssociationInformation{associationRow.m_targetId, false, false, false,
+                                       std::string{}, std::string{}, std::string{},
+                                       std::string{}});
+        }
+    }
 
     return associationInformationList;
 }
@@ -609,12 +680,35 @@ inline auto RegisteredObjectTemplate<TBASE, TALIAS>::GetRegistryName() const
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
-template <typename TOBJECT>
-inline auto RegisteredObjectTemplate<TBASE, TALIAS>::IsAssociated() const noexcept
+auto RegisteredObjectTemplate<TBASE, TALIAS>::MemoryUsage() const
 {
     const auto lock = ReadLock{m_mutex};
-    return (this->IsObjectInAssocMultiMap<TOBJECT>(m_serializableAssocMultiMap) ||
-            this->IsObjectInAssocMultiMap<TOBJECT>(m_unserializableAssocMultiMap));
+
+    auto memoryReport = MemoryReport{};
+    memoryReport.m_mutexBytes = sizeof(Mutex);
+
+    // The multimap shares the associations held by the set, so only the set counts them.
+    memoryReport.m_associationBytes =
+        HashContainerBytes(m_serializableAssociations) +
+        HashContainerBytes(m_serializableAssocMultiMap) +
+        m_serializableAssociations.size() * (sizeof(ObjectAssociationBase) + CONTROL_BLOCK_BYTES);
+
+    for (const auto &assocElement : m_serializableAssocMultiMap)
+        memoryReport.m_associationBytes += HashContainerBytes(assocElement.second);
+
+    return memoryReport;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TOBJECT>
+inline auto RegisteredObjectTemplate<TBASE, TALIAS>::IsAssociated() const
+{
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    return this->IsAnyAssociatedObjectAlive<TOBJECT_D>(
+        this->GetAssociationTable().GetTargetIds(m_id, GetTypeTag<TOBJECT_D>()));
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -622,54 +716,65 @@ inline auto RegisteredObjectTemplate<TBASE, TALIAS>::IsAssociated() const noexce
 template <typename TBASE, typename TALIAS>
 template <typename TOBJECT, typename TINDICATOR>
 inline auto RegisteredObjectTemplate<TBASE, TALIAS>::IsAssociated(TINDICATOR &&indicator) const
-    noexcept
 {
-    const auto lock = ReadLock{m_mutex};
-
     using TOBJECT_D = std::decay_t<TOBJECT>;
-    using TINDICATOR_D = std::decay_t<TINDICATOR>;
 
-    return (this->IsObjectInAssocMultiMap<TOBJECT_D>(m_serializableAssocMultiMap,
-                                                     std::forward<TINDICATOR_D>(indicator)) ||
-            this->IsObjectInAssocMultiMap<TOBJECT_D>(m_unserializableAssocMultiMap,
-                                                     std::forward<TINDICATOR_D>(indicator)));
+    return this->IsAnyAssociatedObjectAlive<TOBJECT_D>(
+        this->GetAssociationTable().GetTargetIds(m_id, GetTypeTag<TOBJECT_D>(), indicator));
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
 template <typename TTHIS, typename TOBJECT>
+inline auto RegisteredObjectTemplate<TBASE, TALIAS>::Associate(const Handle<TOBJECT> &handle,
+                                                               const bool reciprocate)
+{
+    return this->Associate<TTHIS>(this->GetKoala().template FetchRegistry<TOBJECT>().Get(handle),
+                                  reciprocate);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TTHIS, typename TOBJECT, typename>
 auto RegisteredObjectTemplate<TBASE, TALIAS>::Associate(TOBJECT &&object, const bool reciprocate)
 {
     this->TestAssociationObjectSuitability(
         object);  // this will throw a descriptive error if it fails
 
-    using TOBJECT_D = std::decay_t<TOBJECT>;
     using TTHIS_D = std::decay_t<TTHIS>;
 
-    // Instantiating the association automatically forms a reciprocal association with the other
-    // object if reciprocate is true.
-    auto spThisObject = std::dynamic_pointer_cast<TTHIS_D>(this->GetSharedPointer());
+    const auto spThisObject = std::dynamic_pointer_cast<TTHIS_D>(this->GetSharedPointer());
     if (!spThisObject) KL_THROW("Object could not be cast to desired type for association");
 
-    auto spAssociationBase = ObjectAssociationBase::sPtr{new ObjectAssociation<TOBJECT_D>{
-        *spThisObject, std::forward<TOBJECT_D>(object), reciprocate}};
-
-    const auto lock = WriteLock{m_mutex};
-    return this->AddAssociation<TOBJECT_D>(std::move(spAssociationBase));
+    // An empty indicator stands for no indicator.
+    return this->FormAssociation(*spThisObject, object, std::string{}, reciprocate);
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
 template <typename TTHIS, typename TOBJECT, typename TINDICATOR>
+inline auto RegisteredObjectTemplate<TBASE, TALIAS>::Associate(const Handle<TOBJECT> &handle,
+                                                               TINDICATOR &&indicator,
+                                                               const bool reciprocate)
+{
+    return this->Associate<TTHIS>(this->GetKoala().template FetchRegistry<TOBJECT>().Get(handle),
+                                  std::forward<TINDICATOR>(indicator), reciprocate);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TTHIS, typename TOBJECT, typename TINDICATOR, typename>
 auto RegisteredObjectTemplate<TBASE, TALIAS>::Associate(TOBJECT &&object, TINDICATOR &&indicator,
                                                         const bool reciprocate)
 {
     this->TestAssociationObjectSuitability(
         object);  // this will throw a descriptive error if it fails
 
-    using TOBJECT_D = std::decay_t<TOBJECT>;
+    using TTHIS_D = std::decay_t<TTHIS>;
     using TINDICATOR_D = std::decay_t<TINDICATOR>;
 
     static_assert(std::is_default_constructible<TINDICATOR_D>::value,
@@ -683,33 +788,47 @@ auto RegisteredObjectTemplate<TBASE, TALIAS>::Associate(TOBJECT &&object, TINDIC
     static_assert(std::is_copy_assignable<TINDICATOR_D>::value,
                   "Association indicators must be copy-assignable");
 
-    // Instantiating the association automatically forms a reciprocal association with the other
-    // object if reciprocate is true.
-    auto &thisObject = *std::dynamic_pointer_cast<std::decay_t<TTHIS>>(this->GetSharedPointer());
-    auto spAssociationBase =
-        ObjectAssociationBase::sPtr{new ObjectAssociation<TOBJECT_D, TINDICATOR_D>{
-            thisObject, std::forward<TOBJECT_D>(object), reciprocate,
-            std::forward<TINDICATOR_D>(indicator)}};
-    const auto lock = WriteLock{m_mutex};
-    return this->AddAssociation<TOBJECT_D>(std::move(spAssociationBase));
+    const auto spThisObject = std::dynamic_pointer_cast<TTHIS_D>(this->GetSharedPointer());
+    if (!spThisObject) KL_THROW("Object could not be cast to desired type for association");
+
+    return this->FormAssociation(*spThisObject, object,
+                                 static_cast<const TINDICATOR_D &>(indicator), reciprocate);
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
 template <typename TTHIS, typename TOBJECT>
+inline auto RegisteredObjectTemplate<TBASE, TALIAS>::Dissociate(const Handle<TOBJECT> &handle,
+                                                                const bool reciprocate)
+{
+    return this->Dissociate<TTHIS>(this->GetKoala().template FetchRegistry<TOBJECT>().Get(handle),
+                                   reciprocate);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TTHIS, typename TOBJECT, typename>
 auto RegisteredObjectTemplate<TBASE, TALIAS>::Dissociate(TOBJECT &&object, const bool reciprocate)
 {
-    const auto lock = WriteLock{m_mutex};
     this->TestAssociationObjectSuitability(
         object);  // this will throw a descriptive error if it fails
 
-    if (!this->RemoveAssociation(object)) return false;
+    using TTHIS_D = std::decay_t<TTHIS>;
+    using TOBJECT_D = std::decay_t<TOBJECT>;
+
+    const auto objectId = object.ID();
+    if (this->GetAssociationTable().DissociateTarget(m_id, objectId, GetTypeTag<TOBJECT_D>()) ==
+        SIZE_T(0UL))
+        return false;
+
+    this->EraseSerializableAssociations<TOBJECT_D>(
+        objectId, [](const ObjectAssociationBase::sPtr &) { return true; });
 
     // If we can't make the dissolution, then either the user made a one-way association in the
     // first place or something bad has happened.
-    using TTHIS_D = std::decay_t<TTHIS>;
-    if (reciprocate && !object.template Dissociate<std::decay_t<TOBJECT>, TTHIS_D>(
+    if (reciprocate && !object.template Dissociate<TOBJECT_D>(
                            *std::dynamic_pointer_cast<TTHIS_D>(this->GetSharedPointer()), false))
     {
         KL_ASSERT(false, "Could not reciprocate association dissolution for object of base type "
@@ -724,30 +843,58 @@ auto RegisteredObjectTemplate<TBASE, TALIAS>::Dissociate(TOBJECT &&object, const
 
 template <typename TBASE, typename TALIAS>
 template <typename TTHIS, typename TOBJECT, typename TINDICATOR>
+inline auto RegisteredObjectTemplate<TBASE, TALIAS>::Dissociate(const Handle<TOBJECT> &handle,
+                                                                TINDICATOR &&indicator,
+                                                                const bool reciprocate)
+{
+    return this->Dissociate<TTHIS>(this->GetKoala().template FetchRegistry<TOBJECT>().Get(handle),
+                                   std::forward<TINDICATOR>(indicator), reciprocate);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+template <typename TBASE, typename TALIAS>
+template <typename TTHIS, typename TOBJECT, typename TINDICATOR, typename>
 auto RegisteredObjectTemplate<TBASE, TALIAS>::Dissociate(TOBJECT &&object, TINDICATOR &&indicator,
                                                          const bool reciprocate)
 {
-    const auto lock = WriteLock{m_mutex};
     this->TestAssociationObjectSuitability(
         object);  // this will throw a descriptive error if it fails
 
-    if (!this->RemoveAssociation(object, indicator)) return false;
-
-    // If we can't make the dissolution, then either the user made a one-way association in the
-    // first place or something bad has happened.
     using TTHIS_D = std::decay_t<TTHIS>;
+    using TOBJECT_D = std::decay_t<TOBJECT>;
     using TINDICATOR_D = std::decay_t<TINDICATOR>;
+    using IndicatorTraits = AssociationTable::IndicatorTraits<TINDICATOR_D>;
+    using TSTORED = typename IndicatorTraits::Stored;
+
+    const auto objectId = object.ID();
+    const auto &indicatorRef = static_cast<const TINDICATOR_D &>(indicator);
 
-    if (reciprocate && !object.template Dissociate<std::decay_t<TOBJECT>>(
+    if (!this->GetAssociationTable().Dissociate(m_id, objectId, GetTypeTag<TOBJECT_D>(),
+                                                indicatorRef))
+        return false;
+
+    this->EraseSerializableAssociations<TOBJECT_D>(
+        objectId, [&indicatorRef](const ObjectAssociationBase::sPtr &spAssociationBase) {
+            const auto spAssociation =
+                std::dynamic_pointer_cast<ObjectAssociation<TOBJECT_D, TSTORED>>(
+                    spAssociationBase);
+            return (spAssociation &&
+                    (spAssociation->Indicator() == IndicatorTraits::Key(indicatorRef)));
+        });
+
+    // If we can't make the dissolution, then either the user made a one-way association in the
+    // first place or something bad has happened.
+    if (reciprocate && !object.template Dissociate<TOBJECT_D>(
                            *std::dynamic_pointer_cast<TTHIS_D>(this->GetSharedPointer()),
-                           std::forward<TINDICATOR_D>(indicator), false))
+                           indicatorRef, false))
     {
         KL_ASSERT(false, "Could not reciprocate association dissolution for object of base type "
                              << KL_WHITE_BOLD << this->GetRegistry().PrintableBaseName()
                              << KL_NORMAL << ": association integrity has been broken");
     }
 
-    return false;
+    return true;
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -756,17 +903,10 @@ template <typename TBASE, typename TALIAS>
 template <typename TOBJECT>
 auto RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociatedObjects() const
 {
-    const auto lock = ReadLock{m_mutex};
     using TOBJECT_D = std::decay_t<TOBJECT>;
 
-    auto associatedObjects =
-        this->GetAssociatedObjectsFromMap<TOBJECT_D>(m_serializableAssocMultiMap);
-    auto unserAssocObjects =
-        this->GetAssociatedObjectsFromMap<TOBJECT_D>(m_unserializableAssocMultiMap);
-    associatedObjects.insert(std::make_move_iterator(unserAssocObjects.begin()),
-                             std::make_move_iterator(unserAssocObjects.end()));
-
-    return associatedObjects;
+    return this->GetAssociatedObjectsFromIds<TOBJECT_D>(
+        this->GetAssociationTable().GetTargetIds(m_id, GetTypeTag<TOBJECT_D>()));
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -775,17 +915,10 @@ template <typename TBASE, typename TALIAS>
 template <typename TOBJECT, typename TINDICATOR>
 auto RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociatedObjects(TINDICATOR &&indicator) const
 {
-    const auto lock = ReadLock{m_mutex};
     using TOBJECT_D = std::decay_t<TOBJECT>;
 
-    auto associatedObjects =
-        this->GetAssociatedObjectsFromMap<TOBJECT_D>(m_serializableAssocMultiMap, indicator);
-    auto unserAssocObjects =
-        this->GetAssociatedObjectsFromMap<TOBJECT_D>(m_unserializableAssocMultiMap, indicator);
-    associatedObjects.insert(std::make_move_iterator(unserAssocObjects.begin()),
-                             std::make_move_iterator(unserAssocObjects.end()));
-
-    return associatedObjects;
+    return this->GetAssociatedObjectsFromIds<TOBJECT_D>(
+        this->GetAssociationTable().GetTargetIds(m_id, GetTypeTag<TOBJECT_D>(), indicator));
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -794,27 +927,10 @@ template <typename TBASE, typename TALIAS>
 template <typename TOBJECT>
 auto &RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociatedObject() const
 {
-    const auto lock = ReadLock{m_mutex};
     using TOBJECT_D = std::decay_t<TOBJECT>;
 
-    auto spSerReturnAssoc =
-        this->GetAssociatedObjectFromMap<TOBJECT_D>(m_serializableAssocMultiMap);
-    auto spUnserReturnAssoc =
-        this->GetAssociatedObjectFromMap<TOBJECT_D>(m_unserializableAssocMultiMap);
-
-    if (spSerReturnAssoc && spUnserReturnAssoc)
-    {
-        KL_THROW(
-            "Used 'GetAssociatedObject' but there was more than one association for object of base "
-            "type "
-            << KL_WHITE_BOLD << this->GetRegistry().PrintableBaseName());
-    }
-
-    if (spSerReturnAssoc || spUnserReturnAssoc)
-        return spSerReturnAssoc ? spSerReturnAssoc->Get() : spUnserReturnAssoc->Get();
-
-    KL_THROW("There were no live objects of this type found for object of base type "
-             << KL_WHITE_BOLD << this->GetRegistry().PrintableBaseName());
+    return this->GetAssociatedObjectFromIds<TOBJECT_D>(
+        this->GetAssociationTable().GetTargetIds(m_id, GetTypeTag<TOBJECT_D>()));
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -823,46 +939,22 @@ template <typename TBASE, typename TALIAS>
 template <typename TOBJECT, typename TINDICATOR>
 auto &RegisteredObjectTemplate<TBASE, TALIAS>::GetAssociatedObject(TINDICATOR &&indicator) const
 {
-    const auto lock = ReadLock{m_mutex};
     using TOBJECT_D = std::decay_t<TOBJECT>;
 
-    auto spSerReturnAssoc =
-        this->GetAssociatedObjectFromMap<TOBJECT_D>(m_serializableAssocMultiMap, indicator);
-    auto spUnserReturnAssoc =
-        this->GetAssociatedObjectFromMap<TOBJECT_D>(m_unserializableAssocMultiMap, indicator);
-
-    if (spSerReturnAssoc && spUnserReturnAssoc)
-    {
-        KL_THROW(
-            "Used 'GetAssociatedObject' but there was more than one association for object of base "
-            "type "
-            << KL_WHITE_BOLD << this->GetRegistry().PrintableBaseName());
-    }
-
-    if (spSerReturnAssoc || spUnserReturnAssoc)
-        return spSerReturnAssoc ? spSerReturnAssoc->Get() : spUnserReturnAssoc->Get();
-
-    KL_THROW("There were no live objects of this type found for object of base type "
-             << KL_WHITE_BOLD << this->GetRegistry().PrintableBaseName());
+    return this->GetAssociatedObjectFromIds<TOBJECT_D>(
+        this->GetAssociationTable().GetTargetIds(m_id, GetTypeTag<TOBJECT_D>(), indicator));
 }
 
 //--------------------------------------------------------------------------------------------------
 
 template <typename TBASE, typename TALIAS>
 template <typename TOBJECT>
-inline auto RegisteredObjectTemplate<TBASE, TALIAS>::AssociatedObjects() const noexcept
+inline auto RegisteredObjectTemplate<TBASE, TALIAS>::AssociatedObjects() const
 {
-    const auto lock = ReadLock{m_mutex};
     using TOBJECT_D = std::decay_t<TOBJECT>;
-    return RangeBasedContainer<ObjectAssociationBase::sPtrSet, ObjectAssociationBase,
-                               ObjectAssociation<TOBJECT_D>, TOBJECT_D>{
-        [](const ObjectAssociationBase::sPtr &spAssocBase) { return spAssocBase->IsAlive(); },
-        [](const ObjectAssociationBase::sPtr &spAssocBase) { return spAssocBase; },
-        [](const typename ObjectAssociation<std::decay_t<TOBJECT>>::sPtr &spAssoc)
-            -> auto &{return spAssoc->Get();
-}
-, ReadLock{m_mutex}, ReadLock{}, m_serializableAssociations, m_unserializableAssociations
-};  // namespace kl
+
+    return this->MakeAssociatedObjectContainer<TOBJECT_D>(
+        this->GetAssociationTable().GetTargetIds(m_id, GetTypeTag<TOBJECT_D>()));
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -870,26 +962,11 @@ inline auto RegisteredObjectTemplate<TBASE, TALIAS>::AssociatedObjects() const n
 template <typename TBASE, typename TALIAS>
 template <typename TOBJECT, typename TINDICATOR>
 inline auto RegisteredObjectTemplate<TBASE, TALIAS>::AssociatedObjects(TINDICATOR &&indicator) const
-    noexcept
 {
-    const auto lock = ReadLock{m_mutex};
     using TOBJECT_D = std::decay_t<TOBJECT>;
-    using TINDICATOR_D = std::decay_t<TINDICATOR>;
-    return RangeBasedContainer<ObjectAssociationBase::sPtrSet, ObjectAssociationBase,
-                               ObjectAssociation<TOBJECT_D, TINDICATOR_D>, TOBJECT_D>{
-        [&indicator](const ObjectAssociationBase::sPtr &spAssocBase) {
-            const auto spAssociation =
-                std::dynamic_pointer_cast<ObjectAssociation<TOBJECT_D, TINDICATOR_D>>(spAssocBase);
-            return (spAssociation && spAssociation->IsAlive() &&
-                    (spAssociation->Indicator() == indicator));
-        },
-        [](const ObjectAssociationBase::sPtr &spAssocBase) { return spAssocBase; },
-        [](const typename ObjectAssociation<TOBJECT_D, TINDICATOR_D>::sPtr &spAssoc)
-            -> auto &{return spAssoc->Get();
-}
-, ReadLock{m_mutex}, ReadLock{}, m_serializableAssociations, m_unserializableAssociations
-}
-;
+
+    return this->MakeAssociatedObjectContainer<TOBJECT_D>(
+        this->GetAssociationTable().GetTargetIds(m_id, GetTypeTag<TOBJECT_D>(), indicator));
 }
 
 //--------------------------------------------------------------------------------------------------
@@ -0,0 +1,327 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/test/TestRangeAlgorithm.cxx
+ *
+ * @brief Implementation of the test range algorithm (TestRangeAlgorithm) class.
+ */
+
+#include "TestRangeAlgorithm.h"
+#include "TestEdge.h"
+#include "TestObject.h"
+#include "TestSubObject.h"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief RangeValue struct, a plain value to view through a range-based container.
+ */
+struct RangeValue
+{
+    std::size_t m_value;  ///< The value.
+};
+}  // namespace
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+namespace kl
+{
+TestRangeAlgorithm::TestRangeAlgorithm(Registry_wPtr wpRegistry, const kl::ID_t id,
+                                       Koala_wPtr wpKoala) noexcept
+    : Algorithm{std::move_if_noexcept(wpRegistry), id, std::move_if_noexcept(wpKoala)}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+bool TestRangeAlgorithm::Run()
+{
+    this->TestRangeIteration();
+    this->TestLazyView();
+    this->TestInlinedCallables();
+    this->TestStandardAlgorithms();
+    this->TestRangeSnapshot();
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRangeAlgorithm::TestRangeIteration()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto shardCount = registry.ShardCount();
+    const auto nSubObjects = registry.Count<TestSubObject>();
+
+    // With more shards than sub-objects, some of the viewed type buckets are empty.
+    registry.ShardCount(SIZE_T(5UL));
+
+    auto objectIds = IdVector{};
+    for (const auto &object : registry.CreateMany<TestObject>(SIZE_T(6UL)))
+        objectIds.push_back(object.get().ID());
+
+    auto subObjectIds = IdVector{};
+    for (const auto &object : registry.CreateMany<TestSubObject>(SIZE_T(3UL)))
+        subObjectIds.push_back(object.get().ID());
+
+    auto listedIds = IdVector{};
+    for (const auto &object : registry.GetAll<TestSubObject>())
+        if (object.ID() >= subObjectIds.front()) listedIds.push_back(object.ID());
+
+    std::sort(listedIds.begin(), listedIds.end());
+    KL_ASSERT(((listedIds == subObjectIds) &&
+               (registry.GetAll<TestSubObject>().size() == nSubObjects + SIZE_T(3UL))),
+              "Range over a subclass did not hold exactly its objects");
+
+    // The ordered range walks the shards' slots in ID order, so it lists the new objects last.
+    auto orderedIds = IdVector{};
+    for (const auto &object : registry.GetAllOrdered<TestObject>())
+        if (object.ID() >= objectIds.front()) orderedIds.push_back(object.ID());
+
+    auto expectedIds = objectIds;
+    expectedIds.insert(expectedIds.end(), subObjectIds.cbegin(), subObjectIds.cend());
+    KL_ASSERT((orderedIds == expectedIds), "Ordered range did not list the objects in ID order");
+
+    // Daughters reached through either kind of edge are listed, and the edge range keeps only the
+    // edges of the type asked for.
+    auto &parent = registry.Get<TestObject>(objectIds.front());
+    for (auto index = SIZE_T(1UL); index < SIZE_T(4UL); ++index)
+        parent.AddDaughterEdge(registry.Get<TestObject>(objectIds[index]));
+
+    parent.AddDaughterEdge<TestEdge>(registry.Get<TestObject>(objectIds[4]));
+    parent.AddDaughterEdge<TestEdge>(registry.Get<TestObject>(objectIds[5]));
+
+    auto daughterIds = IdVector{};
+    for (const auto &daughter : parent.Daughters<TestObject>())
+        daughterIds.push_back(daughter.ID());
+
+    std::sort(daughterIds.begin(), daughterIds.end());
+    KL_ASSERT(((daughterIds == IdVector{objectIds.begin() + 1, objectIds.end()}) &&
+               (parent.DaughterEdges<TestEdge>().size() == SIZE_T(2UL))),
+              "Range over daughters did not hold every daughter once");
+
+    // A range with nothing left to view begins at its end.
+    registry.DeleteMany(subObjectIds);
+
+    {
+        const auto subObjects = registry.GetAll<TestSubObject>();
+        KL_ASSERT(((nSubObjects != SIZE_T(0UL)) || !(subObjects.begin() != subObjects.end())),
+                  "Empty range did not begin at its end");
+    }
+
+    registry.DeleteMany(objectIds);
+    registry.ShardCount(shardCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRangeAlgorithm::TestLazyView()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto shardCount = registry.ShardCount();
+
+    // A sharded registry hands its range copies of the type buckets, which the range owns.
+    registry.ShardCount(SIZE_T(3UL));
+
+    auto objectIds = IdVector{};
+    for (const auto &object : registry.CreateMany<TestObject>(SIZE_T(4UL)))
+        objectIds.push_back(object.get().ID());
+
+    for (const auto &object : registry.CreateMany<TestSubObject>(SIZE_T(3UL)))
+        objectIds.push_back(object.get().ID());
+
+    {
+        auto subObjects = registry.GetAll<TestSubObject>();
+        const auto objects = subObjects.ToVector();
+
+        KL_ASSERT(((objects.size() == subObjects.size()) &&
+                   (subObjects.size() == registry.Count<TestSubObject>())),
+                  "Lazy view did not count the objects it iterates over");
+
+        auto index = SIZE_T(0UL);
+        for (const auto &object : subObjects)
+        {
+            KL_ASSERT(((&object == &objects[index].get()) &&
+                       (&subObjects.get(index) == &object)),
+                      "Lazy view did not copy or index its objects in iteration order");
+            ++index;
+        }
+
+        // Moving the view keeps the object sets it owns, and so what it iterates over.
+        const auto movedSubObjects = std::move(subObjects);
+        KL_ASSERT((movedSubObjects.ToVector().size() == objects.size()),
+                  "Lazy view lost its objects when moved");
+
+        auto isThrown = false;
+
+        try
+        {
+            movedSubObjects.get(objects.size());
+        }
+
+        catch (const KoalaException &)
+        {
+            isThrown = true;
+        }
+
+        KL_ASSERT(isThrown, "Lazy view gave an object for an index past its last object");
+    }
+
+    registry.DeleteMany(objectIds);
+    registry.ShardCount(shardCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRangeAlgorithm::TestInlinedCallables()
+{
+    using Value_sPtr = std::shared_ptr<RangeValue>;
+    using Value_sPtrVector = std::vector<Value_sPtr>;
+
+    auto spValues = Value_sPtrVector{};
+    for (auto value = SIZE_T(0UL); value < SIZE_T(6UL); ++value)
+        spValues.push_back(std::make_shared<RangeValue>(RangeValue{value}));
+
+    // A null entry fails the cast, so the validity function must never see it.
+    spValues.insert(spValues.begin() + 3, Value_sPtr{});
+
+    const auto divisor = SIZE_T(2UL);
+    auto nValidityCalls = SIZE_T(0UL);
+
+    const auto evenValues =
+        MakeRangeBasedContainer<Value_sPtrVector, RangeValue, RangeValue, RangeValue>(
+            [&nValidityCalls, divisor](const Value_sPtr &spValue) {
+                ++nValidityCalls;
+                return (spValue->m_value % divisor == SIZE_T(0UL));
+            },
+            [](const Value_sPtr &spValue) { return spValue; },
+            [](const Value_sPtr &spValue) -> auto & { return *spValue; }, ReadLock{}, ReadLock{},
+            spValues);
+
+    auto listedValues = std::vector<std::size_t>{};
+    for (const auto &value : evenValues) listedValues.push_back(value.m_value);
+
+    KL_ASSERT((listedValues == std::vector<std::size_t>{SIZE_T(0UL), SIZE_T(2UL), SIZE_T(4UL)}),
+              "Range with capturing functions listed the wrong values");
+    KL_ASSERT((nValidityCalls == SIZE_T(6UL)),
+              "Validity function was not called exactly once per live value");
+    KL_ASSERT(((evenValues.size() == SIZE_T(3UL)) && (nValidityCalls == SIZE_T(12UL))),
+              "Validity function state was not kept across loops");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRangeAlgorithm::TestStandardAlgorithms()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+
+    auto objectIds = IdVector{};
+    for (const auto &object : registry.CreateMany<TestObject>(SIZE_T(9UL)))
+        objectIds.push_back(object.get().ID());
+
+    const auto firstId = objectIds.front();
+    const auto isNew = [firstId](const TestObject &object) { return object.ID() >= firstId; };
+
+    {
+        const auto objects = registry.GetAll<TestObject>();
+        using Iterator = decltype(objects.begin());
+
+        static_assert(std::is_same<typename std::iterator_traits<Iterator>::iterator_category,
+                                   std::forward_iterator_tag>::value,
+                      "Range iterators are not forward iterators");
+        static_assert(std::is_same<typename std::iterator_traits<Iterator>::value_type,
+                                   TestObject>::value,
+                      "Range iterators have the wrong value type");
+
+        // Each chunk is run through the standard algorithms on its own.
+        auto nObjects = std::ptrdiff_t{0L};
+        auto nNewObjects = std::ptrdiff_t{0L};
+
+        for (const auto &chunk : objects.Split(SIZE_T(3UL)))
+        {
+            nObjects += std::distance(chunk.begin(), chunk.end());
+            nNewObjects += std::count_if(chunk.begin(), chunk.end(), isNew);
+        }
+
+        KL_ASSERT(((static_cast<std::size_t>(nObjects) == objects.size()) &&
+                   (nNewObjects == static_cast<std::ptrdiff_t>(objectIds.size()))),
+                  "Standard algorithms over the chunks missed objects");
+
+        const auto iter = std::find_if(objects.begin(), objects.end(), isNew);
+        KL_ASSERT(((iter != objects.end()) && (iter->ID() >= firstId)),
+                  "Standard algorithm did not find an object");
+
+        const auto maxIter = std::max_element(
+            objects.begin(), objects.end(),
+            [](const TestObject &lhs, const TestObject &rhs) { return lhs.ID() < rhs.ID(); });
+        KL_ASSERT(((maxIter != objects.end()) && (maxIter->ID() == objectIds.back())),
+                  "Standard algorithm did not find the last object");
+
+        // A copy of an iterator stays where it was while the original moves on.
+        auto walker = objects.begin();
+        const auto copy = walker++;
+        KL_ASSERT(((copy == objects.begin()) && (walker != copy) && (std::next(copy) == walker)),
+                  "Copied iterators did not walk the range independently");
+    }
+
+    registry.DeleteMany(objectIds);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRangeAlgorithm::TestRangeSnapshot()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+
+    auto objectIds = IdVector{};
+    for (const auto &object : registry.CreateMany<TestObject>(SIZE_T(5UL)))
+        objectIds.push_back(object.get().ID());
+
+    const auto firstId = objectIds.front();
+    auto &parent = registry.Get<TestObject>(firstId);
+    parent.AddDaughterEdge(registry.Get<TestObject>(objectIds[1]));
+    parent.AddDaughterEdge<TestEdge>(registry.Get<TestObject>(objectIds[2]));
+
+    // Taking the snapshot of a temporary range leaves the edge mutex unlocked, so the parent can
+    // gain daughters while the snapshot is looped over.
+    const auto daughters = parent.Daughters<TestObject>().Snapshot();
+    const auto edges = parent.DaughterEdges<TestEdge>().Snapshot();
+    parent.AddDaughterEdge<TestEdge>(registry.Get<TestObject>(objectIds[3]));
+
+    auto daughterIds = IdVector{};
+    for (const auto &daughter : daughters) daughterIds.push_back(daughter.ID());
+
+    std::sort(daughterIds.begin(), daughterIds.end());
+    KL_ASSERT(((daughterIds == IdVector{objectIds[1], objectIds[2]}) &&
+               (parent.Daughters<TestObject>().size() == SIZE_T(3UL))),
+              "Snapshot of daughters did not hold the daughters it was taken of");
+    KL_ASSERT(((edges.size() == SIZE_T(1UL)) &&
+               (parent.DaughterEdges<TestEdge>().size() == SIZE_T(2UL))),
+              "Snapshot of edges did not hold the edges it was taken of");
+
+    // Likewise the registry lock, so the objects can be deleted while the snapshot keeps them.
+    const auto objects = registry.GetAll<TestObject>().Snapshot();
+    registry.DeleteMany(objectIds);
+
+    auto nSnapshotObjects = SIZE_T(0UL);
+    for (const auto &object : objects)
+        if (object.ID() >= firstId) ++nSnapshotObjects;
+
+    KL_ASSERT(((nSnapshotObjects == objectIds.size()) &&
+               !registry.DoesObjectExist<TestObject>(objectIds.back())),
+              "Snapshot did not keep the objects deleted during the loop alive");
+}
+}  // namespace kl
@@ -0,0 +1,124 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/test/TestRangeAlgorithm.h
+ *
+ * @brief Header file for the test range algorithm (TestRangeAlgorithm) class.
+ */
+
+#ifndef KL_TEST_RANGE_ALGORITHM_H
+#define KL_TEST_RANGE_ALGORITHM_H 1
+
+#include "koala/Algorithm.h"
+
+namespace kl
+{
+/**
+ * @brief TestRangeAlgorithm class, checking the behaviour of the range-based containers through
+ * which registries and hierarchies are looped over.
+ */
+class TestRangeAlgorithm : public Algorithm
+{
+public:
+    /**
+     * @brief Deleted copy constructor.
+     */
+    TestRangeAlgorithm(const TestRangeAlgorithm &) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    TestRangeAlgorithm(TestRangeAlgorithm &&) = delete;
+
+    /**
+     * @brief Deleted copy assignment operator.
+     */
+    TestRangeAlgorithm &operator=(const TestRangeAlgorithm &) = delete;
+
+    /**
+     * @brief Deleted move assignment operator.
+     */
+    TestRangeAlgorithm &operator=(TestRangeAlgorithm &&) = delete;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TestRangeAlgorithm() = default;
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief Get a printable name for the object.
+     *
+     * @return A printable name for the object.
+     */
+    KL_PRINTABLE_NAME("TestRangeAlgorithm");
+
+    /**
+     * @brief Get a string that identifies a given instantiation of the object.
+     *
+     * @return A string that identifies a given instantiation of the object.
+     */
+    KL_IDENTIFIER_STRING(this->HasAlias() ? this->Alias() : std::string{});
+
+protected:
+    /**
+     * @brief Constructor.
+     *
+     * @param wpRegistry Weak pointer to the associated registry.
+     * @param id Unique ID for the object.
+     * @param wpKoala Weak pointer to the instance of Koala.
+     */
+    TestRangeAlgorithm(Registry_wPtr wpRegistry, const kl::ID_t id, Koala_wPtr wpKoala) noexcept;
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief Run the algorithm.
+     *
+     * @return Success.
+     */
+    bool Run() override;
+
+    friend Registry;  ///< Alias for the object registry from the base class.
+    friend class Koala;
+
+private:
+    /**
+     * @brief Check that ranges walk every object set they view, including empty ones, in order,
+     * and skip the objects that fail their type and validity filters.
+     */
+    void TestRangeIteration();
+
+    /**
+     * @brief Check that the lazy view counts, copies and indexes the same objects it iterates over,
+     * also once moved, and refuses an index past its last object.
+     */
+    void TestLazyView();
+
+    /**
+     * @brief Check that a range made with capturing functions keeps their state, calls the validity
+     * function only for values that pass the cast, and calls it once per value per loop.
+     */
+    void TestInlinedCallables();
+
+    /**
+     * @brief Check that range and chunk iterators are forward iterators, which the standard
+     * algorithms accept and which can be copied and walked again.
+     */
+    void TestStandardAlgorithms();
+
+    /**
+     * @brief Check that a snapshot releases the locks of the range it was taken from, so objects
+     * and edges can be added and deleted during the loop, and keeps its objects alive meanwhile.
+     */
+    void TestRangeSnapshot();
+};
+}  // namespace kl
+
+#endif  // #ifndef KL_TEST_RANGE_ALGORITHM_H
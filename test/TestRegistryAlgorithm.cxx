@@ -0,0 +1,1153 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/test/TestRegistryAlgorithm.cxx
+ *
+ * @brief Implementation of the test registry algorithm (TestRegistryAlgorithm) class.
+ */
+
+#include "TestRegistryAlgorithm.h"
+#include "TestObject.h"
+#include "TestSubObject.h"
+
+#include "koala/Registry/PagedSlotVector.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <tuple>
+
+namespace kl
+{
+TestRegistryAlgorithm::TestRegistryAlgorithm(Registry_wPtr wpRegistry, const kl::ID_t id,
+                                             Koala_wPtr wpKoala) noexcept
+    : Algorithm{std::move_if_noexcept(wpRegistry), id, std::move_if_noexcept(wpKoala)}
+{
+}
+
+//--------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------
+
+bool TestRegistryAlgorithm::Run()
+{
+    this->TestShardedEquivalence();
+    this->TestBulkDeletion();
+    this->TestBatchedCreation();
+    this->TestObjectArena();
+    this->TestSlotStorage();
+    this->TestAliasIndex();
+    this->TestTypedLookup();
+    this->TestReadMostlyVisibility();
+    this->TestTypeCounts();
+    this->TestHandles();
+    this->TestParallelForEach();
+    this->TestRegistrySnapshot();
+    this->TestMemoryUsage();
+    this->TestReservation();
+    this->TestChangeJournalOverflow();
+    this->TestDeferredDeletion();
+    this->TestIdRanges();
+    this->TestRangeSplitting();
+    this->TestDissociation();
+    this->TestIndicatorDissociation();
+
+    return true;
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestShardedEquivalence()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto shardCount = registry.ShardCount();
+
+    // Describe the contents left by a fixed sequence of operations relative to the first new ID.
+    using Contents = std::vector<std::pair<ID_t, std::string>>;
+    const auto runOperations = [&registry]() {
+        const auto nObjects = registry.CountAll();
+
+        auto objectIds = IdVector{};
+        for (auto index = SIZE_T(0UL); index < SIZE_T(12UL); ++index)
+        {
+            if (index % SIZE_T(3UL) == SIZE_T(0UL))
+                objectIds.push_back(
+                    registry.CreateByAlias<TestObject>("Sharded" + std::to_string(index)).ID());
+            else
+                objectIds.push_back(registry.Create<TestObject>().ID());
+        }
+
+        registry.Delete(objectIds[4]);
+        registry.Delete(std::string{"Sharded6"});
+        registry.AddAlias(objectIds[5], std::string{"Sharded5"});
+
+        auto contents = Contents{};
+        for (const auto objectId : objectIds)
+        {
+            if (!registry.DoesObjectExist<TestObject>(objectId)) continue;
+
+            const auto alias = registry.HasAlias(objectId) ? registry.GetAlias(objectId)
+                                                           : std::string{};
+            KL_ASSERT((alias.empty() || (registry.Get<TestObject>(alias).ID() == objectId)),
+                      "Alias does not lead back to its object");
+            contents.emplace_back(objectId - objectIds.front(), alias);
+        }
+
+        auto listedIds = IdVector{};
+        for (const auto &object : registry.GetAll<TestObject>()) listedIds.push_back(object.ID());
+
+        for (const auto &content : contents)
+            KL_ASSERT((std::count(listedIds.begin(), listedIds.end(),
+                                  objectIds.front() + content.first) == 1),
+                      "Did not list an object exactly once");
+        KL_ASSERT((registry.CountAll() == nObjects + contents.size()),
+                  "Counted the wrong number of objects");
+
+        registry.DeleteMany(objectIds);
+        KL_ASSERT((registry.CountAll() == nObjects), "Did not delete the objects");
+
+        return contents;
+    };
+
+    registry.ShardCount(SIZE_T(1UL));
+    const auto unshardedContents = runOperations();
+    registry.ShardCount(SIZE_T(4UL));
+    const auto shardedContents = runOperations();
+
+    KL_ASSERT(((unshardedContents == shardedContents) && (shardedContents.size() == SIZE_T(10UL))),
+              "Sharded and unsharded registries diverged");
+
+    // Resharding redistributes the objects, which stay reachable by ID and by alias.
+    auto objectIds = IdVector{};
+    for (auto index = SIZE_T(0UL); index < SIZE_T(9UL); ++index)
+        objectIds.push_back(
+            registry.CreateByAlias<TestObject>("Resharded" + std::to_string(index)).ID());
+
+    for (const auto newShardCount : {SIZE_T(3UL), SIZE_T(1UL), SIZE_T(4UL)})
+    {
+        registry.ShardCount(newShardCount);
+
+        for (auto index = SIZE_T(0UL); index < objectIds.size(); ++index)
+        {
+            const auto alias = "Resharded" + std::to_string(index);
+            KL_ASSERT(((registry.Get<TestObject>(objectIds[index]).ID() == objectIds[index]) &&
+                       (registry.Get<TestObject>(alias).ID() == objectIds[index])),
+                      "Lost an object while resharding");
+        }
+    }
+
+    registry.DeleteMany(objectIds);
+    registry.ShardCount(shardCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestBulkDeletion()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto nObjects = registry.Count<TestObject>();
+
+    auto objectIds = IdVector{};
+    for (auto index = SIZE_T(0UL); index < SIZE_T(10UL); ++index)
+        objectIds.push_back(
+            registry.CreateByAlias<TestObject>("Bulk" + std::to_string(index)).ID());
+
+    // Duplicated and unknown IDs are counted once and skipped respectively.
+    const auto deletedIds = IdVector{objectIds[1], objectIds[3], objectIds[1],
+                                     objectIds.back() + ID_t{1000UL}};
+    KL_ASSERT((registry.DeleteMany(deletedIds) == SIZE_T(2UL)),
+              "DeleteMany miscounted the deleted objects");
+
+    const auto firstId = objectIds.front();
+    const auto isEven = [firstId](const TestObject &object) {
+        return (object.ID() >= firstId) && ((object.ID() - firstId) % ID_t{2UL} == ID_t{0UL});
+    };
+    KL_ASSERT((registry.DeleteIf(isEven) == SIZE_T(5UL)),
+              "DeleteIf miscounted the deleted objects");
+    KL_ASSERT((registry.DeleteIf(isEven) == SIZE_T(0UL)), "DeleteIf deleted an object twice");
+
+    // Only the odd objects other than the first and third survive.
+    for (auto index = SIZE_T(0UL); index < objectIds.size(); ++index)
+    {
+        const auto alias = "Bulk" + std::to_string(index);
+        const auto isKept = (index % SIZE_T(2UL) == SIZE_T(1UL)) && (index != SIZE_T(1UL)) &&
+                            (index != SIZE_T(3UL));
+
+        KL_ASSERT(((registry.DoesObjectExist<TestObject>(objectIds[index]) == isKept) &&
+                   (registry.DoesObjectExist<TestObject>(alias) == isKept)),
+                  "Deleted the wrong objects");
+        KL_ASSERT((!isKept || (registry.Get<TestObject>(alias).ID() == objectIds[index])),
+                  "Lost the alias of a remaining object");
+    }
+
+    KL_ASSERT((registry.Count<TestObject>() == nObjects + SIZE_T(3UL)),
+              "Type count out of step with the deletions");
+
+    auto listedIds = IdVector{};
+    for (const auto &object : registry.GetAll<TestObject>())
+        if (object.ID() >= firstId) listedIds.push_back(object.ID());
+
+    std::sort(listedIds.begin(), listedIds.end());
+    KL_ASSERT((listedIds == IdVector{objectIds[5], objectIds[7], objectIds[9]}),
+              "Type bucket out of step with the deletions");
+
+    // A deleted alias can be given out again.
+    registry.CreateByAlias<TestObject>(std::string{"Bulk0"});
+    KL_ASSERT((registry.DeleteMany(IdVector{objectIds[5], objectIds[7], objectIds[9]}) ==
+               SIZE_T(3UL)),
+              "DeleteMany miscounted the deleted objects");
+    KL_ASSERT(registry.Delete(std::string{"Bulk0"}), "Could not reuse a deleted alias");
+    KL_ASSERT((registry.Count<TestObject>() == nObjects), "Left objects behind");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestBatchedCreation()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto nObjects = registry.Count<TestObject>();
+
+    const auto objects = registry.CreateMany<TestObject>(SIZE_T(5UL));
+    KL_ASSERT((objects.size() == SIZE_T(5UL)), "Created the wrong number of objects");
+
+    auto objectIds = IdVector{};
+    for (auto index = SIZE_T(0UL); index < objects.size(); ++index)
+    {
+        objectIds.push_back(objects[index].get().ID());
+        KL_ASSERT(((objectIds.back() == objectIds.front() + index) &&
+                   (&registry.Get<TestObject>(objectIds.back()) == &objects[index].get())),
+                  "Batched objects do not have a contiguous block of IDs in order");
+    }
+
+    // A generator throwing partway through leaves none of the batch registered.
+    const auto nextId = registry.Create<TestObject>().ID();
+    objectIds.push_back(nextId);
+
+    auto isThrown = false;
+
+    try
+    {
+        registry.CreateManyFrom<TestObject>(SIZE_T(4UL), [](const std::size_t index) {
+            if (index == SIZE_T(2UL)) throw std::runtime_error{"Generator failed"};
+            return std::tuple<>{};
+        });
+    }
+
+    catch (const std::runtime_error &)
+    {
+        isThrown = true;
+    }
+
+    KL_ASSERT(isThrown, "Did not propagate the exception thrown by the generator");
+    KL_ASSERT((registry.Count<TestObject>() == nObjects + SIZE_T(6UL)),
+              "Left part of a failed batch registered");
+
+    for (auto objectId = nextId + ID_t{1UL}; objectId <= nextId + ID_t{4UL}; ++objectId)
+        KL_ASSERT(!registry.DoesObjectExist<TestObject>(objectId),
+                  "Left an object from a failed batch registered");
+
+    // The registry carries on creating objects after the failed batch.
+    const auto laterObjects = registry.CreateMany<TestObject>(SIZE_T(2UL));
+    KL_ASSERT((laterObjects.front().get().ID() > nextId + ID_t{4UL}),
+              "Reused an ID given out to a failed batch");
+
+    for (const auto &object : laterObjects) objectIds.push_back(object.get().ID());
+
+    KL_ASSERT((registry.DeleteMany(objectIds) == SIZE_T(8UL)), "Could not delete batched objects");
+    KL_ASSERT((registry.Count<TestObject>() == nObjects), "Left objects behind");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestObjectArena()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto nObjects = registry.Count<TestObject>();
+
+    // Slabs a few objects wide make the arena grow several times.
+    registry.EnableArena<TestObject>(SIZE_T(4UL) * sizeof(TestObject) + SIZE_T(256UL));
+
+    auto objectIds = IdVector{};
+    for (auto index = SIZE_T(0UL); index < SIZE_T(16UL); ++index)
+        objectIds.push_back(
+            registry.CreateByAlias<TestObject>("Arena" + std::to_string(index)).ID());
+
+    for (const auto &object : registry.CreateMany<TestObject>(SIZE_T(8UL)))
+        objectIds.push_back(object.get().ID());
+
+    registry.DisableArena<TestObject>();
+    objectIds.push_back(registry.Create<TestObject>().ID());
+
+    // Delete every other object, so that every slab is left partly occupied.
+    auto keptIds = IdVector{};
+    for (auto index = SIZE_T(0UL); index < objectIds.size(); ++index)
+    {
+        if (index % SIZE_T(2UL) == SIZE_T(0UL)) registry.Delete(objectIds[index]);
+        else keptIds.push_back(objectIds[index]);
+    }
+
+    for (const auto objectId : keptIds)
+        KL_ASSERT((registry.Get<TestObject>(objectId).ID() == objectId),
+                  "Lost an object created in an arena");
+
+    KL_ASSERT((registry.Get<TestObject>(std::string{"Arena3"}).ID() == objectIds[3]),
+              "Lost the alias of an object created in an arena");
+    KL_ASSERT((registry.Count<TestObject>() == nObjects + keptIds.size()),
+              "Miscounted the objects created in an arena");
+
+    registry.DeleteMany(keptIds);
+    KL_ASSERT((registry.Count<TestObject>() == nObjects), "Left objects behind");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestSlotStorage()
+{
+    // Pages of four slots, so that a handful of indices spans several pages.
+    auto slots = PagedSlotVector<std::unique_ptr<std::size_t>, SIZE_T(4UL)>{};
+
+    for (const auto index : {SIZE_T(1UL), SIZE_T(5UL), SIZE_T(6UL), SIZE_T(13UL)})
+        slots.Emplace(index, std::make_unique<std::size_t>(index));
+
+    KL_ASSERT(((slots.Size() == SIZE_T(4UL)) && (slots.PageCount() == SIZE_T(3UL))),
+              "Allocated the wrong pages");
+
+    for (auto index = SIZE_T(0UL); index < SIZE_T(20UL); ++index)
+    {
+        const auto pSlot = slots.Find(index);
+        const auto isOccupied = (index == SIZE_T(1UL)) || (index == SIZE_T(5UL)) ||
+                                (index == SIZE_T(6UL)) || (index == SIZE_T(13UL));
+
+        KL_ASSERT(((pSlot != nullptr) == isOccupied), "Found the wrong slots");
+        KL_ASSERT((!pSlot || (**pSlot == index)), "Found a slot holding the wrong value");
+    }
+
+    auto visitedIndices = std::vector<std::size_t>{};
+    slots.ForEachInRange(SIZE_T(2UL), SIZE_T(13UL), [&](const std::size_t index, const auto &) {
+        visitedIndices.push_back(index);
+    });
+    KL_ASSERT((visitedIndices == std::vector<std::size_t>{5UL, 6UL, 13UL}),
+              "Visited the wrong slots in a range");
+
+    // Emptying a page releases it, and a later page reuses it.
+    KL_ASSERT((*slots.Erase(SIZE_T(5UL)) == SIZE_T(5UL)), "Erased the wrong slot");
+    KL_ASSERT((!slots.Erase(SIZE_T(5UL)) && !slots.Erase(SIZE_T(100UL))),
+              "Erased a tombstone");
+    slots.Erase(SIZE_T(6UL));
+    KL_ASSERT(((slots.Size() == SIZE_T(2UL)) && !slots.Find(SIZE_T(6UL))),
+              "Did not erase the slots");
+
+    slots.Emplace(SIZE_T(17UL), std::make_unique<std::size_t>(SIZE_T(17UL)));
+    KL_ASSERT(((slots.PageCount() == SIZE_T(3UL)) && (**slots.Find(SIZE_T(17UL)) == 17UL)),
+              "Did not reuse an emptied page");
+
+    visitedIndices.clear();
+    slots.ForEach([&](const std::size_t index, const auto &) { visitedIndices.push_back(index); });
+    KL_ASSERT((visitedIndices == std::vector<std::size_t>{1UL, 13UL, 17UL}),
+              "Visited the wrong slots");
+
+    // Lookups of IDs never given out, or of deleted objects, find nothing.
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto objectId = registry.Create<TestObject>().ID();
+
+    KL_ASSERT((registry.DoesObjectExist<TestObject>(objectId) &&
+               !registry.DoesObjectExist<TestObject>(objectId + ID_t{1UL}) &&
+               !registry.DoesObjectExist<TestObject>(objectId + (ID_t{1UL} << ID_t{20UL}))),
+              "Found an object that was never created");
+
+    registry.Delete(objectId);
+    KL_ASSERT(!registry.DoesObjectExist<TestObject>(objectId), "Found a deleted object");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestAliasIndex()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto shardCount = registry.ShardCount();
+    registry.ShardCount(SIZE_T(4UL));
+
+    const auto firstId = registry.CreateByAlias<TestObject>(std::string{"AliasFirst"}).ID();
+    const auto secondId = registry.Create<TestObject>().ID();
+    registry.AddAlias(secondId, std::string{"AliasSecond"});
+
+    // Heterogeneous lookups find the object without making a string of the key.
+    const auto aliasView = std::string_view{"AliasFirst"};
+    KL_ASSERT(((registry.Get<TestObject>(aliasView).ID() == firstId) &&
+               (registry.Get<TestObject>("AliasFirst").ID() == firstId) &&
+               (registry.Get<TestObject>(std::string_view{"AliasSecond"}).ID() == secondId)),
+              "Could not look up an alias by a string view or C string");
+    KL_ASSERT((registry.DoesObjectExist<TestObject>("AliasSecond") &&
+               !registry.DoesObjectExist<TestObject>(std::string_view{"AliasThird"})),
+              "Could not query an alias by a string view or C string");
+
+    // Taking an alias already in use, or aliasing an object twice, is refused.
+    const auto isRefused = [](auto &&function) {
+        try
+        {
+            function();
+        }
+
+        catch (const KoalaException &)
+        {
+            return true;
+        }
+
+        return false;
+    };
+
+    const auto nObjects = registry.Count<TestObject>();
+    KL_ASSERT(isRefused([&]() { registry.CreateByAlias<TestObject>(std::string{"AliasFirst"}); }),
+              "Created an object with an alias already in use");
+    KL_ASSERT(isRefused([&]() { registry.AddAlias(secondId, std::string{"AliasFirst"}); }),
+              "Gave an object an alias already in use");
+    KL_ASSERT(isRefused([&]() { registry.AddAlias(firstId, std::string{"AliasOther"}); }),
+              "Gave an object a second alias");
+
+    KL_ASSERT(((registry.Count<TestObject>() == nObjects) &&
+               (registry.GetAlias(firstId) == "AliasFirst") &&
+               (registry.GetAlias(secondId) == "AliasSecond") &&
+               !registry.DoesObjectExist<TestObject>("AliasOther")),
+              "A refused alias disturbed the registry");
+
+    // Deleting an object by its alias releases the alias.
+    KL_ASSERT(registry.Delete("AliasFirst"), "Could not delete an object by its alias");
+    const auto thirdId = registry.CreateByAlias<TestObject>(std::string{"AliasFirst"}).ID();
+    KL_ASSERT((registry.Get<TestObject>(aliasView).ID() == thirdId), "Did not reuse an alias");
+
+    registry.DeleteMany(IdVector{secondId, thirdId});
+    registry.ShardCount(shardCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestTypedLookup()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+
+    for (const auto isReadMostly : {false, true})
+    {
+        registry.ReadMostly(isReadMostly);
+
+        const auto &object = registry.Create<TestObject>();
+        const auto &subObject = registry.CreateByAlias<TestSubObject>(std::string{"TypedSub"});
+
+        KL_ASSERT(((&registry.Get<TestObject>(subObject.ID()) == &subObject) &&
+                   (&registry.Get<TestSubObject>(subObject.ID()) == &subObject) &&
+                   (&registry.Get<TestObject>("TypedSub") == &subObject) &&
+                   (&registry.Get<TestSubObject>("TypedSub") == &subObject)),
+                  "Could not look up an object as its own type or a base type");
+
+        KL_ASSERT((registry.DoesObjectExist<TestObject>(object.ID()) &&
+                   !registry.DoesObjectExist<TestSubObject>(object.ID()) &&
+                   registry.DoesObjectExist<TestSubObject>("TypedSub")),
+                  "Typed existence checks disagree with the object types");
+
+        auto isThrown = false;
+
+        try
+        {
+            registry.Get<TestSubObject>(object.ID());
+        }
+
+        catch (const KoalaException &)
+        {
+            isThrown = true;
+        }
+
+        KL_ASSERT(isThrown, "Looked up an object as a more derived type");
+        KL_ASSERT(((registry.Count<TestSubObject>() == SIZE_T(1UL)) &&
+                   (registry.GetAllList<TestSubObject>().size() == SIZE_T(1UL))),
+                  "Miscounted the objects of a subclass");
+
+        registry.DeleteMany(IdVector{object.ID(), subObject.ID()});
+    }
+
+    registry.ReadMostly(false);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestReadMostlyVisibility()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    registry.ReadMostly(true);
+
+    auto objectIds = IdVector{};
+    for (const auto &object : registry.CreateMany<TestObject>(SIZE_T(100UL)))
+        objectIds.push_back(object.get().ID());
+
+    registry.TakeSnapshot();
+
+    // Lookups through a published snapshot see a creation, an alias and a deletion at once, and
+    // carry on seeing them once enough lookups have been made to rebuild the snapshot.
+    const auto newId = registry.Create<TestObject>().ID();
+    registry.AddAlias(newId, std::string{"ReadMostlyNew"});
+    registry.Delete(objectIds.back());
+
+    for (auto index = SIZE_T(0UL); index < SIZE_T(500UL); ++index)
+    {
+        KL_ASSERT((registry.DoesObjectExist<TestObject>(newId) &&
+                   (registry.Get<TestObject>("ReadMostlyNew").ID() == newId) &&
+                   !registry.DoesObjectExist<TestObject>(objectIds.back())),
+                  "A read-mostly lookup missed a write");
+    }
+
+    objectIds.back() = newId;
+
+    // Readers keep finding the objects that stay while a writer creates and deletes others.
+    auto isWriting = std::atomic<bool>{true};
+    auto nMissedObjects = std::atomic<std::size_t>{SIZE_T(0UL)};
+    auto readers = std::vector<std::thread>{};
+
+    for (auto threadIndex = SIZE_T(0UL); threadIndex < SIZE_T(4UL); ++threadIndex)
+    {
+        readers.emplace_back([&, threadIndex]() {
+            for (auto index = threadIndex; isWriting.load(); ++index)
+            {
+                const auto objectId = objectIds[index % objectIds.size()];
+
+                if (!registry.DoesObjectExist<TestObject>(objectId) ||
+                    (registry.Get<TestObject>(objectId).ID() != objectId))
+                {
+                    ++nMissedObjects;
+                }
+            }
+        });
+    }
+
+    for (auto index = SIZE_T(0UL); index < SIZE_T(200UL); ++index)
+    {
+        const auto churnedId = registry.Create<TestObject>().ID();
+        if (index % SIZE_T(50UL) == SIZE_T(0UL)) registry.TakeSnapshot();
+
+        registry.Delete(churnedId);
+        std::this_thread::yield();
+    }
+
+    isWriting.store(false);
+    for (auto &reader : readers) reader.join();
+
+    KL_ASSERT((nMissedObjects.load() == SIZE_T(0UL)), "A read-mostly lookup missed an object");
+
+    registry.DeleteMany(objectIds);
+    registry.ReadMostly(false);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestTypeCounts()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto shardCount = registry.ShardCount();
+    const auto nObjects = registry.Count<TestObject>();
+    const auto nSubObjects = registry.Count<TestSubObject>();
+
+    registry.ShardCount(SIZE_T(3UL));
+
+    auto objectIds = IdVector{};
+    for (const auto &object : registry.CreateMany<TestObject>(SIZE_T(7UL)))
+        objectIds.push_back(object.get().ID());
+
+    auto subObjectIds = IdVector{};
+    for (const auto &object : registry.CreateMany<TestSubObject>(SIZE_T(5UL)))
+        subObjectIds.push_back(object.get().ID());
+
+    const auto checkCounts = [&](const std::size_t nNewObjects, const std::size_t nNewSubObjects) {
+        KL_ASSERT(((registry.Count<TestObject>() == nObjects + nNewObjects + nNewSubObjects) &&
+                   (registry.Count<TestSubObject>() == nSubObjects + nNewSubObjects)),
+                  "Miscounted the objects of a type and its subclasses");
+
+        auto nListedSubObjects = SIZE_T(0UL);
+        for (const auto &object : registry.GetAll<TestObject>())
+            if (dynamic_cast<const TestSubObject *>(&object)) ++nListedSubObjects;
+
+        KL_ASSERT(((nListedSubObjects == nSubObjects + nNewSubObjects) &&
+                   (registry.GetAllList<TestSubObject>().size() == nSubObjects + nNewSubObjects)),
+                  "Listed the wrong objects of a subclass");
+    };
+
+    checkCounts(SIZE_T(7UL), SIZE_T(5UL));
+
+    registry.DeleteMany(IdVector{objectIds[0], subObjectIds[0], subObjectIds[1]});
+    checkCounts(SIZE_T(6UL), SIZE_T(3UL));
+
+    registry.ShardCount(SIZE_T(1UL));
+    checkCounts(SIZE_T(6UL), SIZE_T(3UL));
+
+    const auto firstSubObjectId = subObjectIds.front();
+    const auto nDeleted = registry.DeleteIf([firstSubObjectId](const TestObject &object) {
+        return (object.ID() >= firstSubObjectId) &&
+               (dynamic_cast<const TestSubObject *>(&object) != nullptr);
+    });
+    KL_ASSERT((nDeleted == SIZE_T(3UL)), "Deleted the wrong objects of a subclass");
+    checkCounts(SIZE_T(6UL), SIZE_T(0UL));
+
+    registry.DeleteMany(objectIds);
+    registry.ShardCount(shardCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestHandles()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto shardCount = registry.ShardCount();
+
+    auto &object = registry.Create<TestObject>();
+    auto &subObject = registry.Create<TestSubObject>();
+    const auto handle = registry.GetHandle(object);
+    const auto subHandle = registry.GetHandle(subObject);
+    const auto baseHandle = Handle<TestObject>{subHandle};
+
+    for (const auto newShardCount : {SIZE_T(4UL), SIZE_T(1UL), SIZE_T(3UL)})
+    {
+        registry.ShardCount(newShardCount);
+
+        for (const auto isReadMostly : {false, true})
+        {
+            registry.ReadMostly(isReadMostly);
+
+            KL_ASSERT(((registry.Resolve(handle) == &object) &&
+                       (registry.Resolve(subHandle) == &subObject) &&
+                       (registry.Resolve(baseHandle) == &subObject) &&
+                       (&registry.Get(handle) == &object)),
+                      "Could not resolve a handle after resharding");
+            KL_ASSERT(((registry.Resolve(Handle<TestSubObject>{object.ID()}) == nullptr) &&
+                       (registry.Resolve(Handle<TestObject>{}) == nullptr)),
+                      "Resolved a handle to an object of the wrong type, or a null handle");
+        }
+    }
+
+    // Handles can form associations, and outlive their objects without resolving to anything.
+    object.Associate(subHandle);
+    KL_ASSERT((object.IsAssociated<TestSubObject>() && subObject.IsAssociated<TestObject>()),
+              "Could not associate objects through a handle");
+
+    KL_ASSERT(registry.Delete(subHandle), "Could not delete an object by its handle");
+    KL_ASSERT(!registry.Delete(subHandle), "Deleted an object twice by its handle");
+    KL_ASSERT(((registry.Resolve(subHandle) == nullptr) &&
+               (registry.Resolve(baseHandle) == nullptr) &&
+               !object.IsAssociated<TestSubObject>()),
+              "A handle resolved to a deleted object");
+
+    auto isThrown = false;
+
+    try
+    {
+        registry.Get(subHandle);
+    }
+
+    catch (const KoalaException &)
+    {
+        isThrown = true;
+    }
+
+    KL_ASSERT(isThrown, "Got a deleted object by its handle");
+
+    // IDs are never given out again, so a later object is never reached through a stale handle.
+    const auto &laterObject = registry.Create<TestSubObject>();
+    KL_ASSERT(((laterObject.ID() != subHandle.ID()) && (registry.Resolve(subHandle) == nullptr)),
+              "A stale handle resolved to a later object");
+
+    registry.DeleteMany(IdVector{object.ID(), laterObject.ID()});
+    registry.ReadMostly(false);
+    registry.ShardCount(shardCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestParallelForEach()
+{
+    constexpr auto N_OBJECTS = SIZE_T(3000UL);
+    constexpr auto N_THREADS = SIZE_T(4UL);
+
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto nObjects = registry.Count<TestObject>();
+
+    const auto objects = registry.CreateMany<TestObject>(N_OBJECTS);
+    const auto firstId = objects.front().get().ID();
+
+    // Each new object is visited exactly once, across several chunks.
+    auto visits = std::unique_ptr<std::atomic<std::size_t>[]>{
+        new std::atomic<std::size_t>[N_OBJECTS]{}};
+
+    const auto nVisited = registry.ParallelForEach<TestObject>(
+        [&visits, firstId](const TestObject &object) {
+            if (object.ID() >= firstId) ++visits[object.ID() - firstId];
+        },
+        N_THREADS);
+
+    KL_ASSERT((nVisited == nObjects + N_OBJECTS), "Miscounted the visited objects");
+    KL_ASSERT(std::all_of(visits.get(), visits.get() + N_OBJECTS,
+                          [](const std::atomic<std::size_t> &nVisits) {
+                              return nVisits.load() == SIZE_T(1UL);
+                          }),
+              "Did not visit every object exactly once");
+
+    // The first exception is rethrown and the registry is left usable.
+    auto isThrown = false;
+
+    try
+    {
+        registry.ParallelForEach<TestObject>(
+            [firstId](const TestObject &object) {
+                if (object.ID() == firstId + ID_t{10UL})
+                    throw std::runtime_error{"Function failed"};
+            },
+            N_THREADS);
+    }
+
+    catch (const std::runtime_error &)
+    {
+        isThrown = true;
+    }
+
+    KL_ASSERT(isThrown, "Did not propagate the exception thrown by the function");
+
+    // The function runs with no lock held, so it may look up and delete objects, and objects it
+    // deletes are still visited; the threads are kept for the next call.
+    const auto nPoolThreads = WorkerPool::Get().ThreadCount();
+    auto nDeleted = std::atomic<std::size_t>{SIZE_T(0UL)};
+
+    registry.ParallelForEach<TestObject>(
+        [&registry, &nDeleted, firstId](const TestObject &object) {
+            if ((object.ID() < firstId) || !registry.DoesObjectExist<TestObject>(object.ID()))
+                return;
+
+            if (registry.Delete(object.ID())) ++nDeleted;
+        },
+        N_THREADS);
+
+    KL_ASSERT((nDeleted.load() == N_OBJECTS), "Function could not delete the visited objects");
+    KL_ASSERT((WorkerPool::Get().ThreadCount() == nPoolThreads),
+              "Started new threads instead of reusing the pool");
+    KL_ASSERT((registry.Count<TestObject>() == nObjects), "Left objects behind");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestRegistrySnapshot()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto nObjects = registry.Count<TestObject>();
+
+    for (const auto isReadMostly : {false, true})
+    {
+        registry.ReadMostly(isReadMostly);
+
+        const auto keptId = registry.CreateByAlias<TestObject>("SnapshotKept").ID();
+        const auto deletedId = registry.Create<TestObject>().ID();
+        const auto snapshot = registry.TakeSnapshot();
+
+        // Writes made after the snapshot was taken are not seen through it, and the objects
+        // deleted since are kept alive by it.
+        registry.Delete(deletedId);
+        const auto newId = registry.CreateByAlias<TestObject>("SnapshotNew").ID();
+
+        KL_ASSERT(((snapshot.Count<TestObject>() == nObjects + SIZE_T(2UL)) &&
+                   (snapshot.CountAll() == nObjects + SIZE_T(2UL))),
+                  "Snapshot count changed after a write");
+        KL_ASSERT((snapshot.DoesObjectExist<TestObject>(deletedId) &&
+                   (snapshot.Get<TestObject>(deletedId).ID() == deletedId)),
+                  "Snapshot lost an object deleted after it was taken");
+        KL_ASSERT((!snapshot.DoesObjectExist<TestObject>(newId) &&
+                   (snapshot.Get<TestObject>("SnapshotKept").ID() == keptId)),
+                  "Snapshot saw an object created after it was taken");
+
+        auto isThrown = false;
+
+        try
+        {
+            snapshot.Get<TestObject>("SnapshotNew");
+        }
+
+        catch (const KoalaException &)
+        {
+            isThrown = true;
+        }
+
+        KL_ASSERT(isThrown, "Snapshot saw an alias added after it was taken");
+
+        auto visitedIds = IdVector{};
+        snapshot.ForEach<TestObject>(
+            [&visitedIds](const TestObject &object) { visitedIds.push_back(object.ID()); });
+
+        KL_ASSERT(((visitedIds.size() == nObjects + SIZE_T(2UL)) &&
+                   (std::count(visitedIds.cbegin(), visitedIds.cend(), deletedId) == 1L) &&
+                   (std::count(visitedIds.cbegin(), visitedIds.cend(), newId) == 0L)),
+                  "Snapshot iteration did not match the contents when it was taken");
+
+        // A snapshot taken after the writes sees them.
+        const auto laterSnapshot = registry.TakeSnapshot();
+        KL_ASSERT((laterSnapshot.DoesObjectExist<TestObject>(newId) &&
+                   !laterSnapshot.DoesObjectExist<TestObject>(deletedId) &&
+                   (laterSnapshot.Get<TestObject>("SnapshotNew").ID() == newId)),
+                  "Later snapshot missed a write");
+
+        registry.DeleteMany(IdVector{keptId, newId});
+    }
+
+    registry.ReadMostly(false);
+    KL_ASSERT((registry.Count<TestObject>() == nObjects), "Left objects behind");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestMemoryUsage()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto emptyReport = registry.MemoryUsage();
+
+    auto objectIds = IdVector{};
+    for (auto index = SIZE_T(0UL); index < SIZE_T(100UL); ++index)
+        objectIds.push_back(
+            registry.CreateByAlias<TestObject>("Memory" + std::to_string(index)).ID());
+
+    const auto report = registry.MemoryUsage();
+    KL_ASSERT(((report.m_objectBytes > emptyReport.m_objectBytes) &&
+               (report.m_indexBytes > emptyReport.m_indexBytes) &&
+               (report.m_mutexBytes > emptyReport.m_mutexBytes)),
+              "Memory report did not grow with the objects");
+    KL_ASSERT((report.TotalBytes() == report.m_objectBytes + report.m_indexBytes +
+                                          report.m_associationBytes + report.m_edgeBytes +
+                                          report.m_mutexBytes),
+              "Memory report total is not the sum of its categories");
+
+    // The association rows are counted by the registry.
+    auto &first = registry.Get<TestObject>(objectIds.front());
+    first.Associate(registry.Get<TestObject>(objectIds.back()));
+
+    KL_ASSERT((registry.MemoryUsage().m_associationBytes > report.m_associationBytes),
+              "Memory report did not count a new association");
+    KL_ASSERT((first.MemoryUsage().m_mutexBytes > SIZE_T(0UL)),
+              "Object memory report did not count the object mutex");
+
+    const auto koalaReport = this->GetKoala().MemoryUsage();
+    KL_ASSERT((koalaReport.TotalBytes() >= registry.MemoryUsage().TotalBytes()),
+              "Koala memory report left out a registry");
+
+    // Deleting the objects gives back their payloads.
+    registry.DeleteMany(objectIds);
+    KL_ASSERT((registry.MemoryUsage().m_objectBytes == emptyReport.m_objectBytes),
+              "Memory report still counts deleted objects");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestReservation()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto nObjects = registry.Count<TestObject>();
+    const auto maxLoadFactor = registry.MaxLoadFactor();
+
+    // A load factor that is not positive is refused and leaves the old one in place.
+    auto isThrown = false;
+
+    try
+    {
+        registry.MaxLoadFactor(0.0F);
+    }
+
+    catch (const KoalaException &)
+    {
+        isThrown = true;
+    }
+
+    KL_ASSERT((isThrown && (registry.MaxLoadFactor() == maxLoadFactor)),
+              "Accepted a maximum load factor that is not positive");
+
+    // Reserving grows the indices up front, and objects created into the reservation (with a
+    // higher load factor) are found by ID and alias.
+    const auto indexBytes = registry.MemoryUsage().m_indexBytes;
+    registry.Reserve<TestObject>(SIZE_T(500UL), SIZE_T(500UL));
+
+    KL_ASSERT((registry.MemoryUsage().m_indexBytes > indexBytes),
+              "Reserve did not grow the registry indices");
+
+    registry.MaxLoadFactor(4.0F);
+    KL_ASSERT((registry.MaxLoadFactor() == 4.0F), "Did not set the maximum load factor");
+
+    auto objectIds = IdVector{};
+    for (auto index = SIZE_T(0UL); index < SIZE_T(500UL); ++index)
+        objectIds.push_back(
+            registry.CreateByAlias<TestObject>("Reserved" + std::to_string(index)).ID());
+
+    for (auto index = SIZE_T(0UL); index < objectIds.size(); ++index)
+    {
+        KL_ASSERT(((registry.Get<TestObject>("Reserved" + std::to_string(index)).ID() ==
+                    objectIds[index]) &&
+                   registry.DoesObjectExist<TestObject>(objectIds[index])),
+                  "Lost an object created into a reservation");
+    }
+
+    registry.MaxLoadFactor(maxLoadFactor);
+    KL_ASSERT((registry.Get<TestObject>("Reserved0").ID() == objectIds.front()),
+              "Lost an object when the maximum load factor was restored");
+
+    registry.DeleteMany(objectIds);
+    KL_ASSERT((registry.Count<TestObject>() == nObjects), "Left objects behind");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestChangeJournalOverflow()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    registry.EnableChangeJournal(SIZE_T(4UL));
+
+    const auto spChangeJournal = registry.GetChangeJournal();
+    auto cursor = spChangeJournal->NextSequence();
+
+    auto objectIds = IdVector{};
+    for (auto index = SIZE_T(0UL); index < SIZE_T(6UL); ++index)
+        objectIds.push_back(registry.Create<TestObject>().ID());
+
+    // Six creations overflow a journal of four, so the first two are lost.
+    auto readIds = IdVector{};
+    const auto readCreation = [&](const ChangeJournal::Entry &entry) {
+        KL_ASSERT((entry.m_change == ChangeJournal::CHANGE::CREATED),
+                  "Read a change other than a creation");
+        readIds.push_back(entry.m_objectId);
+    };
+
+    KL_ASSERT(!spChangeJournal->Read(cursor, readCreation),
+              "Overflowing the change journal went unreported");
+    KL_ASSERT(((readIds == IdVector{objectIds.begin() + 2, objectIds.end()}) &&
+               (cursor == spChangeJournal->NextSequence())),
+              "Did not read the changes kept by an overflowed change journal");
+
+    // Having caught up, the consumer reads a full journal of changes without losing any.
+    for (auto iter = objectIds.begin() + 2; iter != objectIds.end(); ++iter) registry.Delete(*iter);
+
+    auto deletedIds = IdVector{};
+    KL_ASSERT(spChangeJournal->Read(cursor,
+                                    [&](const ChangeJournal::Entry &entry) {
+                                        if (entry.m_change == ChangeJournal::CHANGE::DELETED)
+                                            deletedIds.push_back(entry.m_objectId);
+                                    }),
+              "Lost changes after catching up with the change journal");
+    KL_ASSERT((deletedIds == IdVector{objectIds.begin() + 2, objectIds.end()}),
+              "Did not read the deletions from the change journal");
+
+    registry.Delete(objectIds[0]);
+    registry.Delete(objectIds[1]);
+    registry.DisableChangeJournal();
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestDeferredDeletion()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    registry.DeferDeletion(true);
+
+    const auto nObjects = registry.CountAll();
+    const auto keptId = registry.Create<TestObject>().ID();
+    const auto firstId = registry.Create<TestObject>().ID();
+    const auto secondId = registry.Create<TestObject>().ID();
+
+    registry.Delete(firstId);
+    registry.Delete(secondId);
+
+    KL_ASSERT((!registry.DoesObjectExist<TestObject>(firstId) &&
+               !registry.DoesObjectExist<TestObject>(secondId) &&
+               (registry.CountAll() == nObjects + SIZE_T(1UL))),
+              "Deferred deletions were not hidden from lookups");
+    KL_ASSERT((registry.PendingDeletionCount() == SIZE_T(2UL)),
+              "Deferred deletions were not held until compaction");
+
+    KL_ASSERT(((registry.Compact() == SIZE_T(2UL)) &&
+               (registry.PendingDeletionCount() == SIZE_T(0UL)) &&
+               (registry.Compact() == SIZE_T(0UL))),
+              "Compact did not release each deferred deletion once");
+    KL_ASSERT(registry.DoesObjectExist<TestObject>(keptId),
+              "Compact released an object that was not deleted");
+
+    // Turning deferral off compacts the registry.
+    registry.Delete(keptId);
+    registry.DeferDeletion(false);
+
+    KL_ASSERT((registry.PendingDeletionCount() == SIZE_T(0UL)),
+              "Turning deferral off did not release the deferred deletions");
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestIdRanges()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto shardCount = registry.ShardCount();
+    registry.ShardCount(SIZE_T(4UL));
+
+    // Consecutive IDs land in different shards, so each range has to be merged across them.
+    auto objectIds = IdVector{};
+    for (auto index = SIZE_T(0UL); index < SIZE_T(10UL); ++index)
+        objectIds.push_back(registry.Create<TestObject>().ID());
+
+    const auto getRangeIds = [&registry](const ID_t firstId, const ID_t lastId) {
+        auto rangeIds = IdVector{};
+        for (const auto &object : registry.GetRange<TestObject>(firstId, lastId))
+            rangeIds.push_back(object.ID());
+
+        return rangeIds;
+    };
+
+    KL_ASSERT((getRangeIds(objectIds[2], objectIds[7]) ==
+               IdVector{objectIds.begin() + 2, objectIds.begin() + 8}),
+              "ID range did not hold exactly the objects between its bounds, in ID order");
+    KL_ASSERT((getRangeIds(objectIds[9], objectIds[9]) == IdVector{objectIds[9]}),
+              "ID range with equal bounds did not hold the one object");
+    KL_ASSERT((getRangeIds(objectIds[9] + 1, std::numeric_limits<ID_t>::max()).empty() &&
+               getRangeIds(objectIds[5], objectIds[4]).empty()),
+              "ID range beyond the last ID or with reversed bounds was not empty");
+
+    registry.Delete(objectIds[3]);
+    KL_ASSERT((getRangeIds(objectIds[2], objectIds[4]) == IdVector{objectIds[2], objectIds[4]}),
+              "ID range held a deleted object");
+
+    for (const auto objectId : objectIds) registry.Delete(objectId);
+    registry.ShardCount(shardCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestRangeSplitting()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    const auto shardCount = registry.ShardCount();
+    registry.ShardCount(SIZE_T(4UL));
+
+    auto &parent = registry.Create<TestObject>();
+    for (auto index = SIZE_T(0UL); index < SIZE_T(10UL); ++index)
+        parent.AddDaughterEdge(registry.Create<TestObject>());
+
+    // The chunks must between them give the objects of the whole range, none twice, however many
+    // chunks are asked for and wherever their boundaries fall.
+    const auto checkSplit = [](const auto &range, const std::size_t nChunks) {
+        auto expectedIds = IdVector{};
+        for (const auto &object : range) expectedIds.push_back(object.ID());
+
+        const auto chunks = range.Split(nChunks);
+        KL_ASSERT(((chunks.size() <= nChunks) && (chunks.empty() == expectedIds.empty())),
+                  "Split into the wrong number of chunks");
+
+        auto chunkIds = IdVector{};
+        for (const auto &chunk : chunks)
+        {
+            for (const auto &object : chunk) chunkIds.push_back(object.ID());
+        }
+
+        std::sort(expectedIds.begin(), expectedIds.end());
+        std::sort(chunkIds.begin(), chunkIds.end());
+        KL_ASSERT((chunkIds == expectedIds), "Chunks did not hold every object exactly once");
+    };
+
+    for (const auto nChunks : {SIZE_T(1UL), SIZE_T(3UL), SIZE_T(4UL), SIZE_T(10UL), SIZE_T(25UL)})
+    {
+        checkSplit(parent.Daughters<TestObject>(), nChunks);
+        checkSplit(registry.GetAll<TestObject>(), nChunks);
+    }
+
+    auto objectIds = IdVector{parent.ID()};
+    for (const auto &daughter : parent.Daughters<TestObject>()) objectIds.push_back(daughter.ID());
+
+    for (const auto objectId : objectIds) registry.Delete(objectId);
+    registry.ShardCount(shardCount);
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestDissociation()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    auto &first = registry.Create<TestObject>();
+    auto &second = registry.Create<TestObject>();
+    auto &third = registry.Create<TestObject>();
+
+    KL_ASSERT((first.Associate(second) && first.Associate(third) && !first.Associate(second)),
+              "Associate did not report whether an association was formed");
+    KL_ASSERT((second.IsAssociated<TestObject>() && (&second.GetAssociatedObject() == &first)),
+              "Association was not reciprocated");
+
+    KL_ASSERT((first.Dissociate(second) && !second.IsAssociated<TestObject>()),
+              "Dissociate did not dissolve the association from both ends");
+    KL_ASSERT((!first.Dissociate(second) && !second.Dissociate(first)),
+              "Dissociate reported dissolving an association that had been dissolved");
+    KL_ASSERT((&first.GetAssociatedObject() == &third),
+              "Dissociate dissolved an association with another object");
+
+    // Dissolving the last association of a type, from the other end, empties its bookkeeping.
+    KL_ASSERT((third.Dissociate(first) && !first.IsAssociated<TestObject>() &&
+               first.GetAssociationInformation().empty()),
+              "Dissociate did not dissolve the last association");
+    KL_ASSERT((first.Associate(third) && (&third.GetAssociatedObject() == &first)),
+              "Could not associate again after dissolving the last association");
+
+    // Deleting an object hides its associations from the objects it was associated with.
+    registry.Delete(third.ID());
+    KL_ASSERT((!first.IsAssociated<TestObject>() &&
+               first.GetAssociatedObjects<TestObject>().empty()),
+              "Association with a deleted object was still visible");
+
+    registry.Delete(first.ID());
+    registry.Delete(second.ID());
+}
+
+//--------------------------------------------------------------------------------------------------
+
+void TestRegistryAlgorithm::TestIndicatorDissociation()
+{
+    auto &registry = this->GetKoala().FetchRegistry<TestObject>();
+    auto &first = registry.Create<TestObject>();
+    auto &second = registry.Create<TestObject>();
+    auto &third = registry.Create<TestObject>();
+
+    const auto getAssociatedIds = [](const TestObject &object, const std::string &indicator) {
+        auto associatedIds = IdVector{};
+        for (const auto &associatedObject : object.GetAssociatedObjects<TestObject>(indicator))
+            associatedIds.push_back(associatedObject.get().ID());
+
+        std::sort(associatedIds.begin(), associatedIds.end());
+        return associatedIds;
+    };
+
+    KL_ASSERT((first.Associate(second, std::string{"a"}) &&
+               first.Associate(second, std::string{"b"}) &&
+               first.Associate(third, std::string{"a"})),
+              "Could not associate with different indicators");
+
+    // Only the association with the given object and indicator is dissolved, from both ends.
+    KL_ASSERT(first.Dissociate(second, std::string{"a"}),
+              "Dissociate did not dissolve the association with the given indicator");
+    KL_ASSERT(((getAssociatedIds(first, "a") == IdVector{third.ID()}) &&
+               (getAssociatedIds(first, "b") == IdVector{second.ID()})),
+              "Dissociate dissolved an association other than the one with the given indicator");
+    KL_ASSERT((getAssociatedIds(second, "a").empty() &&
+               (getAssociatedIds(second, "b") == IdVector{first.ID()}) &&
+               (getAssociatedIds(third, "a") == IdVector{first.ID()})),
+              "Dissociate did not dissolve only the given association at the other end");
+    KL_ASSERT((!first.Dissociate(second, std::string{"a"}) &&
+               !second.Dissociate(first, std::string{"a"})),
+              "Dissociate reported dissolving an association that had been dissolved");
+
+    // Indicators of another type are told apart in the same way.
+    KL_ASSERT((first.Associate(second, 1) && first.Associate(second, 2) &&
+               first.Dissociate(second, 2)),
+              "Could not dissolve an association with an integer indicator");
+    KL_ASSERT((first.IsAssociated<TestObject>(1) && !first.IsAssociated<TestObject>(2) &&
+               (&second.GetAssociatedObject<TestObject>(1) == &first)),
+              "Dissociate dissolved the association with another integer indicator");
+
+    registry.Delete(first.ID());
+    registry.Delete(second.ID());
+    registry.Delete(third.ID());
+}
+}  // namespace kl
@@ -0,0 +1,213 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/test/TestRegistryAlgorithm.h
+ *
+ * @brief Header file for the test registry algorithm (TestRegistryAlgorithm) class.
+ */
+
+#ifndef KL_TEST_REGISTRY_ALGORITHM_H
+#define KL_TEST_REGISTRY_ALGORITHM_H 1
+
+#include "koala/Algorithm.h"
+
+namespace kl
+{
+/**
+ * @brief TestRegistryAlgorithm class, checking the behaviour of the object registry and of the
+ * associations between registered objects.
+ */
+class TestRegistryAlgorithm : public Algorithm
+{
+public:
+    /**
+     * @brief Deleted copy constructor.
+     */
+    TestRegistryAlgorithm(const TestRegistryAlgorithm &) = delete;
+
+    /**
+     * @brief Deleted move constructor.
+     */
+    TestRegistryAlgorithm(TestRegistryAlgorithm &&) = delete;
+
+    /**
+     * @brief Deleted copy assignment operator.
+     */
+    TestRegistryAlgorithm &operator=(const TestRegistryAlgorithm &) = delete;
+
+    /**
+     * @brief Deleted move assignment operator.
+     */
+    TestRegistryAlgorithm &operator=(TestRegistryAlgorithm &&) = delete;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TestRegistryAlgorithm() = default;
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief Get a printable name for the object.
+     *
+     * @return A printable name for the object.
+     */
+    KL_PRINTABLE_NAME("TestRegistryAlgorithm");
+
+    /**
+     * @brief Get a string that identifies a given instantiation of the object.
+     *
+     * @return A string that identifies a given instantiation of the object.
+     */
+    KL_IDENTIFIER_STRING(this->HasAlias() ? this->Alias() : std::string{});
+
+protected:
+    /**
+     * @brief Constructor.
+     *
+     * @param wpRegistry Weak pointer to the associated registry.
+     * @param id Unique ID for the object.
+     * @param wpKoala Weak pointer to the instance of Koala.
+     */
+    TestRegistryAlgorithm(Registry_wPtr wpRegistry, const kl::ID_t id, Koala_wPtr wpKoala) noexcept;
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief Run the algorithm.
+     *
+     * @return Success.
+     */
+    bool Run() override;
+
+    friend Registry;  ///< Alias for the object registry from the base class.
+    friend class Koala;
+
+private:
+    /**
+     * @brief Check that the same creations, deletions and aliases leave the same contents in a
+     * sharded registry as in an unsharded one, and that resharding keeps every object reachable.
+     */
+    void TestShardedEquivalence();
+
+    /**
+     * @brief Check that DeleteIf and DeleteMany delete exactly the objects asked for, count them
+     * once each, and leave the remaining objects, their aliases and the type counts intact.
+     */
+    void TestBulkDeletion();
+
+    /**
+     * @brief Check that batched creation gives the objects a contiguous block of IDs, in order, and
+     * registers none of them if making any of them throws.
+     */
+    void TestBatchedCreation();
+
+    /**
+     * @brief Check that objects created in an arena spanning several slabs behave as heap objects
+     * do, and outlive the arena being disabled.
+     */
+    void TestObjectArena();
+
+    /**
+     * @brief Check that paged slot storage finds exactly the occupied slots, across pages that
+     * are allocated, emptied and reused, and that registry lookups of missing IDs fail cleanly.
+     */
+    void TestSlotStorage();
+
+    /**
+     * @brief Check that aliases can be looked up as strings, string views or C strings, across
+     * shards, and that an alias already taken is refused without disturbing its object.
+     */
+    void TestAliasIndex();
+
+    /**
+     * @brief Check that typed lookups hand out an object as its own type or any base type, and
+     * refuse it as an unrelated or more derived type, whether looked up by ID or by alias.
+     */
+    void TestTypedLookup();
+
+    /**
+     * @brief Check that read-mostly lookups see every write as soon as it is made, including while
+     * other threads are looking up objects through the published snapshot.
+     */
+    void TestReadMostlyVisibility();
+
+    /**
+     * @brief Check that the count and list of objects of a type take in its subclasses, and keep
+     * in step with creations, deletions and resharding.
+     */
+    void TestTypeCounts();
+
+    /**
+     * @brief Check that handles resolve to their objects through resharding and read-mostly mode,
+     * to nothing once the objects are deleted, and only as the types the objects have.
+     */
+    void TestHandles();
+
+    /**
+     * @brief Check that a parallel for-each visits every object once, lets the function modify the
+     * registry, rethrows the first exception and keeps its threads between calls.
+     */
+    void TestParallelForEach();
+
+    /**
+     * @brief Check that a snapshot keeps the contents the registry had when it was taken, with and
+     * without read-mostly mode, while later snapshots see later writes.
+     */
+    void TestRegistrySnapshot();
+
+    /**
+     * @brief Check that memory reports grow and shrink with the objects and associations that they
+     * count, and that their total is the sum of their categories.
+     */
+    void TestMemoryUsage();
+
+    /**
+     * @brief Check that reserving grows the registry indices up front, and that objects stay
+     * reachable through changes to the maximum load factor, which refuses non-positive values.
+     */
+    void TestReservation();
+
+    /**
+     * @brief Check that a consumer falling behind a full change journal is told which changes it
+     * lost and carries on reading from the oldest change kept.
+     */
+    void TestChangeJournalOverflow();
+
+    /**
+     * @brief Check that deferred deletions hide objects at once and are released by Compact.
+     */
+    void TestDeferredDeletion();
+
+    /**
+     * @brief Check that ID range queries over a sharded registry keep to their bounds and yield
+     * the objects in ID order.
+     */
+    void TestIdRanges();
+
+    /**
+     * @brief Check that splitting ranges into chunks, within one object set and across several,
+     * yields every object exactly once.
+     */
+    void TestRangeSplitting();
+
+    /**
+     * @brief Check that dissolving associations reports whether there was one to dissolve, from
+     * either end, and survives dissolving the last association of a type.
+     */
+    void TestDissociation();
+
+    /**
+     * @brief Check that dissolving an association with a given indicator leaves the associations
+     * with other indicators, or with other objects, in place.
+     */
+    void TestIndicatorDissociation();
+};
+}  // namespace kl
+
+#endif  // #ifndef KL_TEST_REGISTRY_ALGORITHM_H
@@ -0,0 +1,20 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/test/TestSubObject.cxx
+ *
+ * @brief Implementation of the test subobject (TestSubObject) class.
+ */
+
+#include "TestSubObject.h"
+
+TestSubObject::TestSubObject(Registry_wPtr wpRegistry, const kl::ID_t id,
+                             Koala_wPtr wpKoala) noexcept
+    : TestObject(std::move_if_noexcept(wpRegistry), id, std::move_if_noexcept(wpKoala))
+{
+}
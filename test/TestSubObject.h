@@ -0,0 +1,86 @@
+/// @cond
+/**
+ * This file is subject to the terms and conditions defined in file 'LICENSE', which is part of this
+ * source code package.
+ */
+/// @endcond
+
+/**
+ * @file koala/test/TestSubObject.h
+ *
+ * @brief Header file for the test subobject (TestSubObject) class.
+ */
+
+#ifndef KL_TEST_SUB_OBJECT_H
+#define KL_TEST_SUB_OBJECT_H 1
+
+#include "TestObject.h"
+
+/**
+ * @brief TestSubObject class, a subclass of the test object held in the same registry.
+ */
+class TestSubObject : public TestObject
+{
+protected:
+    /**
+     * @brief Constructor.
+     *
+     * @param wpRegistry Weak pointer to the associated registry.
+     * @param id Unique ID for the object.
+     * @param wpKoala Weak pointer to the instance of Koala.
+     */
+    TestSubObject(Registry_wPtr wpRegistry, const kl::ID_t id, Koala_wPtr wpKoala) noexcept;
+
+    friend Registry;  ///< Alias for the object registry from the base class.
+    friend class kl::Koala;
+
+    template <typename T>
+    friend class kl::HierarchicalVisualizationUtility;
+
+    template <typename TA, typename TB>
+    friend class kl::ObjectAssociation;
+
+    template <typename TA, typename TB>
+    friend class kl::RegisteredObjectTemplate;
+
+public:
+    KL_OBJECT_ALIASES(TestSubObject);  ///< Aliases for reference wrappers, sets and vectors.
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief Default copy constructor.
+     */
+    TestSubObject(const TestSubObject &) = default;
+
+    /**
+     * @brief Default move constructor.
+     */
+    TestSubObject(TestSubObject &&) = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     */
+    TestSubObject &operator=(const TestSubObject &) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     */
+    TestSubObject &operator=(TestSubObject &&) = default;
+
+    /**
+     * @brief Default destructor.
+     */
+    ~TestSubObject() = default;
+
+    //----------------------------------------------------------------------------------------------
+
+    /**
+     * @brief Get a printable name for the object.
+     *
+     * @return A printable name for the object.
+     */
+    KL_PRINTABLE_NAME("TestSubObject");
+};
+
+#endif  // #ifndef KL_TEST_SUB_OBJECT_H
@@ -16,6 +16,8 @@
 
 #include "TestAlgorithm.h"
 #include "TestObject.h"
+#include "TestRangeAlgorithm.h"
+#include "TestRegistryAlgorithm.h"
 
 int main()
 {
@@ -27,6 +29,8 @@ int main()
     koalaApi.RegisterRegistry<TestObject>("TestObject");
     koalaApi.Create<TestObject>();
     koalaApi.CreateRunAndDeleteAlgorithm<kl::TestAlgorithm>("TestAlgorithm");
+    koalaApi.CreateRunAndDeleteAlgorithm<kl::TestRegistryAlgorithm>("TestRegistryAlgorithm");
+    koalaApi.CreateRunAndDeleteAlgorithm<kl::TestRangeAlgorithm>("TestRangeAlgorithm");
 
     koalaApi.GetKoala().GetStdout() << "Stdout test" << std::endl;
     koalaApi.GetKoala().GetStderr() << "Stderr test" << std::endl;